@@ -43,6 +43,381 @@ extern "C" {
 
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*!
+ @typedef sapp_input_record
+ @abstract Compact, timestamped copy of a processed sapp_event.
+ @field time Seconds since sapp_input_init when the event was processed.
+ @field type The sapp_event_type of the event, or a SAPP_INPUT_RECORD_GAMEPAD_* type.
+ @field flags SAPP_INPUT_RECORD_* flags.
+ @field code The key code for key events, the mouse button for mouse button events,
+             or (gamepad << 8) | button or axis for gamepad records.
+ @field modifiers The modifier keys at the time of the event, or the touch identifier folded to 32 bits for touch events.
+ @field x Mouse x position, the x scroll amount for scroll events, the touch x position for touch events
+          or the value of gamepad axis records.
+ @field y Mouse y position, the y scroll amount for scroll events or the touch y position for touch events.
+ @field dx Relative mouse x movement.
+ @field dy Relative mouse y movement.
+ */
+typedef struct sapp_input_record {
+    double time;
+    uint8_t type;
+    uint8_t flags;
+    uint16_t code;
+    uint32_t modifiers;
+    float x, y;
+    float dx, dy;
+} sapp_input_record;
+
+/*!
+ @enum sapp_input_record_flags
+ @constant SAPP_INPUT_RECORD_REPEAT The key event was a key repeat.
+ */
+enum {
+    SAPP_INPUT_RECORD_REPEAT = 1 << 0
+};
+
+/*!
+ @enum sapp_input_record_gamepad
+ @abstract Record types for gamepad input, placed after the sapp_event_type values.
+ @constant SAPP_INPUT_RECORD_GAMEPAD_CONNECTED A gamepad was connected.
+ @constant SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED A gamepad was disconnected.
+ @constant SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN A gamepad button was pressed.
+ @constant SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP A gamepad button was released.
+ @constant SAPP_INPUT_RECORD_GAMEPAD_AXIS A gamepad axis changed.
+ */
+enum {
+    SAPP_INPUT_RECORD_GAMEPAD_CONNECTED = 27,
+    SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED,
+    SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN,
+    SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP,
+    SAPP_INPUT_RECORD_GAMEPAD_AXIS
+};
+
+/*!
+ @enum sapp_gamepad_button
+ @abstract Gamepad buttons in the standard layout, named after their position on an Xbox controller.
+ */
+enum {
+    SAPP_GAMEPAD_BUTTON_A,
+    SAPP_GAMEPAD_BUTTON_B,
+    SAPP_GAMEPAD_BUTTON_X,
+    SAPP_GAMEPAD_BUTTON_Y,
+    SAPP_GAMEPAD_BUTTON_BACK,
+    SAPP_GAMEPAD_BUTTON_GUIDE,
+    SAPP_GAMEPAD_BUTTON_START,
+    SAPP_GAMEPAD_BUTTON_LEFT_STICK,
+    SAPP_GAMEPAD_BUTTON_RIGHT_STICK,
+    SAPP_GAMEPAD_BUTTON_LEFT_SHOULDER,
+    SAPP_GAMEPAD_BUTTON_RIGHT_SHOULDER,
+    SAPP_GAMEPAD_BUTTON_DPAD_UP,
+    SAPP_GAMEPAD_BUTTON_DPAD_DOWN,
+    SAPP_GAMEPAD_BUTTON_DPAD_LEFT,
+    SAPP_GAMEPAD_BUTTON_DPAD_RIGHT,
+    SAPP_GAMEPAD_BUTTON_COUNT
+};
+
+/*!
+ @enum sapp_gamepad_axis
+ @abstract Gamepad axes, sticks range from -1 to 1 (down and right are positive), triggers from 0 to 1.
+ */
+enum {
+    SAPP_GAMEPAD_AXIS_LEFT_X,
+    SAPP_GAMEPAD_AXIS_LEFT_Y,
+    SAPP_GAMEPAD_AXIS_RIGHT_X,
+    SAPP_GAMEPAD_AXIS_RIGHT_Y,
+    SAPP_GAMEPAD_AXIS_LEFT_TRIGGER,
+    SAPP_GAMEPAD_AXIS_RIGHT_TRIGGER,
+    SAPP_GAMEPAD_AXIS_COUNT
+};
+
+/*!
+ @enum sapp_gamepad_response_group
+ @abstract Axis groups that share a response, see sapp_input_set_gamepad_response.
+ */
+enum {
+    SAPP_GAMEPAD_RESPONSE_LEFT_STICK,
+    SAPP_GAMEPAD_RESPONSE_RIGHT_STICK,
+    SAPP_GAMEPAD_RESPONSE_TRIGGERS,
+    SAPP_GAMEPAD_RESPONSE_COUNT
+};
+
+/*!
+ @enum sapp_gamepad_deadzone
+ @abstract How stick deadzones are measured.
+ @constant SAPP_GAMEPAD_DEADZONE_RADIAL On the distance from the center, keeps the direction of the stick intact.
+ @constant SAPP_GAMEPAD_DEADZONE_AXIAL On each axis separately, snaps to the axes near the center.
+ */
+enum {
+    SAPP_GAMEPAD_DEADZONE_RADIAL,
+    SAPP_GAMEPAD_DEADZONE_AXIAL
+};
+
+/*!
+ @enum sapp_gamepad_curve
+ @abstract Response curves applied to the input past the deadzone, scaled to 0..1.
+ @constant SAPP_GAMEPAD_CURVE_LINEAR The input unchanged.
+ @constant SAPP_GAMEPAD_CURVE_QUADRATIC The input squared, for finer control near the center.
+ @constant SAPP_GAMEPAD_CURVE_CUSTOM Linear interpolation between the SAPP_GAMEPAD_CURVE_POINTS points of the response.
+ */
+enum {
+    SAPP_GAMEPAD_CURVE_LINEAR,
+    SAPP_GAMEPAD_CURVE_QUADRATIC,
+    SAPP_GAMEPAD_CURVE_CUSTOM
+};
+
+#define SAPP_GAMEPAD_CURVE_POINTS 17
+
+/*!
+ @enum sapp_cursor_prediction
+ @constant SAPP_CURSOR_PREDICT_LINEAR Extrapolate along the average velocity of the most recent samples.
+ @constant SAPP_CURSOR_PREDICT_FILTERED Extrapolate with the filtered velocity and acceleration, see sapp_cursor_velocity.
+ */
+enum {
+    SAPP_CURSOR_PREDICT_LINEAR,
+    SAPP_CURSOR_PREDICT_FILTERED
+};
+
+/*!
+ @enum sapp_gesture_type
+ @constant SAPP_GESTURE_TAP A short press and release without moving.
+ @constant SAPP_GESTURE_DOUBLE_TAP A second tap close to the first one, reported instead of its tap.
+ @constant SAPP_GESTURE_LONG_PRESS A press held still for the long press time.
+ @constant SAPP_GESTURE_SWIPE A quick pan, reported when it ends. dx and dy hold the whole movement.
+ @constant SAPP_GESTURE_PAN One pointer moving. dx and dy hold the movement since the previous pan event.
+ @constant SAPP_GESTURE_PINCH Two pointers moving apart or together. scale is the distance relative to the start.
+ @constant SAPP_GESTURE_ROTATE Two pointers turning. rotation is the angle relative to the start in radians.
+ */
+enum {
+    SAPP_GESTURE_TAP,
+    SAPP_GESTURE_DOUBLE_TAP,
+    SAPP_GESTURE_LONG_PRESS,
+    SAPP_GESTURE_SWIPE,
+    SAPP_GESTURE_PAN,
+    SAPP_GESTURE_PINCH,
+    SAPP_GESTURE_ROTATE
+};
+
+/*!
+ @enum sapp_gesture_phase
+ @constant SAPP_GESTURE_BEGAN A continuous gesture was recognized.
+ @constant SAPP_GESTURE_CHANGED A continuous gesture was updated.
+ @constant SAPP_GESTURE_ENDED A continuous gesture ended, or a discrete gesture (tap, swipe, ...) happened.
+ */
+enum {
+    SAPP_GESTURE_BEGAN,
+    SAPP_GESTURE_CHANGED,
+    SAPP_GESTURE_ENDED
+};
+
+/*!
+ @typedef sapp_gesture
+ @abstract A recognized gesture, see sapp_gesture_event.
+ @field type SAPP_GESTURE_* type.
+ @field phase SAPP_GESTURE_BEGAN, _CHANGED or _ENDED.
+ @field time Seconds since sapp_input_init.
+ @field x Position of the gesture, the midpoint for two pointer gestures.
+ @field y Position of the gesture, the midpoint for two pointer gestures.
+ @field dx Movement for pan and swipe gestures.
+ @field dy Movement for pan and swipe gestures.
+ @field scale Distance between the pointers relative to the start of a pinch.
+ @field rotation Angle of the pointers relative to the start of a rotation, in radians.
+ */
+typedef struct sapp_gesture {
+    int type;
+    int phase;
+    double time;
+    float x, y;
+    float dx, dy;
+    float scale;
+    float rotation;
+} sapp_gesture;
+
+/*!
+ @typedef sapp_gesture_config
+ @abstract Gesture recognizer thresholds, times in seconds and distances in pixels.
+ @field tap_time Longest press that still counts as a tap (default 0.3).
+ @field tap_slop Movement allowed before a press becomes a pan (default 10).
+ @field double_tap_time Longest time between two taps of a double tap (default 0.3).
+ @field double_tap_slop Largest distance between two taps of a double tap (default 30).
+ @field long_press_time Time a press must be held still to become a long press (default 0.5).
+ @field swipe_time Longest pan that counts as a swipe (default 0.3).
+ @field swipe_distance Shortest pan that counts as a swipe (default 50).
+ @field pinch_threshold Scale change needed to begin a pinch (default 0.05).
+ @field rotate_threshold Angle needed to begin a rotation in radians (default 0.1).
+ */
+typedef struct sapp_gesture_config {
+    float tap_time;
+    float tap_slop;
+    float double_tap_time;
+    float double_tap_slop;
+    float long_press_time;
+    float swipe_time;
+    float swipe_distance;
+    float pinch_threshold;
+    float rotate_threshold;
+} sapp_gesture_config;
+
+/*!
+ @typedef sapp_input_context
+ @abstract Opaque handle to an independent input state.
+ @discussion Every function below operates on a default context. Each function also has a sapp_ctx_ variant
+             that takes an explicit context as its first argument, for tracking several input streams in one process.
+ */
+typedef struct sapp_input_context sapp_input_context;
+
+/*!
+ @typedef sapp_gamepad_response
+ @abstract How raw gamepad axes are turned into the values returned by sapp_gamepad_axis.
+ @field deadzone_mode A SAPP_GAMEPAD_DEADZONE_* value, ignored for triggers (default radial).
+ @field deadzone Inputs up to this distance read as 0 (default .15 for sticks, .05 for triggers).
+ @field saturation Inputs from this distance on read as 1 (default 1).
+ @field anti_deadzone The output right past the deadzone, to overcome a deadzone the game applies itself (default 0).
+ @field curve A SAPP_GAMEPAD_CURVE_* value (default linear).
+ @field points The custom curve, output at inputs 0, 1/16, ... 1.
+ */
+typedef struct sapp_gamepad_response {
+    int deadzone_mode;
+    float deadzone;
+    float saturation;
+    float anti_deadzone;
+    int curve;
+    float points[SAPP_GAMEPAD_CURVE_POINTS];
+} sapp_gamepad_response;
+
+/*!
+ @typedef sapp_gamepad_backend
+ @abstract A source of gamepad input, see sapp_input_set_gamepad_backend.
+ @field poll Called by sapp_input_poll_gamepads, reports changes with the sapp_ctx_input_gamepad_* functions.
+ @field shutdown Called when the backend is replaced or its context destroyed, can be NULL.
+ @field user_data Passed to the callbacks.
+ */
+typedef struct sapp_gamepad_backend {
+    void (*poll)(sapp_input_context *ctx, void *user_data);
+    void (*shutdown)(void *user_data);
+    void *user_data;
+} sapp_gamepad_backend;
+
+/*!
+ @typedef sapp_input_state
+ @abstract Read-only copy of a completed frame of input, see sapp_input_snapshot.
+ @discussion Key k is bit (k & 63) of word k >> 6 in the key sets, mouse button b is bit b of the button masks.
+             Use the sapp_state_ helpers to query it.
+ @field frame The number of the frame this snapshot was taken from (counts flushes).
+ @field keys Keys down at the end of the frame.
+ @field keys_pressed Keys that went down during the frame.
+ @field keys_released Keys that went up during the frame.
+ @field buttons Mouse buttons down at the end of the frame.
+ @field buttons_pressed Mouse buttons that went down during the frame.
+ @field buttons_released Mouse buttons that went up during the frame.
+ @field modifiers The modifier keys at the end of the frame.
+ @field cursor_x Cursor x position at the end of the frame.
+ @field cursor_y Cursor y position at the end of the frame.
+ @field cursor_dx Cursor x movement during the frame.
+ @field cursor_dy Cursor y movement during the frame.
+ @field cursor_xf Cursor x position at the end of the frame with sub-pixel precision.
+ @field cursor_yf Cursor y position at the end of the frame with sub-pixel precision.
+ @field mouse_dx Relative x mouse motion during the frame, see sapp_mouse_raw_dx.
+ @field mouse_dy Relative y mouse motion during the frame.
+ @field scroll_x Total x scroll during the frame.
+ @field scroll_y Total y scroll during the frame.
+ */
+typedef struct sapp_input_state {
+    uint64_t frame;
+    uint64_t keys[8];
+    uint64_t keys_pressed[8];
+    uint64_t keys_released[8];
+    uint8_t buttons;
+    uint8_t buttons_pressed;
+    uint8_t buttons_released;
+    uint32_t modifiers;
+    int cursor_x, cursor_y;
+    int cursor_dx, cursor_dy;
+    float cursor_xf, cursor_yf;
+    float mouse_dx, mouse_dy;
+    float scroll_x, scroll_y;
+} sapp_input_state;
+
+/*!
+ @typedef sapp_chord
+ @abstract A set of keys precompiled into a bit mask, see sapp_chord_make.
+ @field keys Key k is bit (k & 63) of keys[k >> 6].
+ */
+typedef struct sapp_chord {
+    uint64_t keys[8];
+} sapp_chord;
+
+/*!
+ @typedef sapp_virtual_axis_desc
+ @abstract An analog axis driven by two actions, see sapp_input_add_virtual_axis.
+ @field negative The action that pushes the axis towards -1, or -1 for none.
+ @field positive The action that pushes the axis towards 1, or -1 for none.
+ @field sensitivity Units per second the axis moves towards -1 or 1 while an action is down, 0 jumps there at once.
+ @field gravity Units per second the axis falls back to 0 once both actions are up, 0 drops to 0 at once.
+ @field snap Reset to 0 first when the direction reverses, instead of ramping through the center.
+ @field use_gamepad Also read gamepad_axis of gamepad, the larger of the two magnitudes wins.
+ @field gamepad The gamepad slot.
+ @field gamepad_axis A SAPP_GAMEPAD_AXIS_* value, read after its deadzone and response curve.
+ */
+typedef struct sapp_virtual_axis_desc {
+    int negative, positive;
+    float sensitivity;
+    float gravity;
+    bool snap;
+    bool use_gamepad;
+    int gamepad;
+    int gamepad_axis;
+} sapp_virtual_axis_desc;
+
+/*!
+ @typedef sapp_input_frame
+ @abstract One frame of input history in its compact 16 byte encoding, see sapp_input_history_frame.
+ @field frame The frame number.
+ @field keys Bit i is the i-th key passed to sapp_input_set_history_keys.
+ @field bits Mouse buttons (bits 0-2), keyboard modifiers (3-6), cursor x and y as 16 bit integers (7-22, 23-38)
+             and scroll x and y as 12 bit fixed point with 1/SOKOL_INPUT_RECORD_SUBPIXEL steps (39-50, 51-62).
+ */
+typedef struct sapp_input_frame {
+    uint64_t frame;
+    uint64_t keys;
+    uint64_t bits;
+} sapp_input_frame;
+
+/*!
+ @typedef sapp_input_write_func
+ @abstract Callback that receives chunks of an input recording, see sapp_input_start_recording.
+ */
+typedef void (*sapp_input_write_func)(const void *data, size_t size, void *user_data);
+
+/*!
+ @typedef sapp_input_replay
+ @abstract Read cursor over an input recording, see sapp_input_replay_init.
+ @discussion The fields are private, treat the struct as opaque.
+ */
+typedef struct sapp_input_replay {
+    const uint8_t *data;
+    size_t size, pos;
+    uint64_t time;
+    int32_t x, y;
+    uint32_t modifiers;
+    bool failed;
+} sapp_input_replay;
+
+/*!
+ @typedef sapp_input_replay_file
+ @abstract Opaque handle to a memory-mapped recording with a seek index, see sapp_input_open_replay.
+ */
+typedef struct sapp_input_replay_file sapp_input_replay_file;
+
+/*!
+ @typedef sapp_input_iter
+ @abstract Iterator over the records of the current frame, see sapp_input_records.
+ */
+typedef struct sapp_input_iter {
+    uint32_t pos, end;
+} sapp_input_iter;
 
 /*!
  @function sapp_input_event
@@ -62,6 +437,8 @@ void sapp_input_flush(void);
  @function sapp_input_init
  @abstract Initialize the input system.
  @discussion Call this function to initialize the input system. Either before sapp_run or in the sapp init callback.
+             Calling it again resets all input state: recording stops, the gamepad backend is shut down and
+             gamepad mappings are dropped.
  */
 void sapp_input_init(void);
 
@@ -77,6 +454,7 @@ bool sapp_is_key_down(int key);
  @param key The key code to check.
  @return True if the key was pressed down in the last frame.
  @abstract Check if a key was pressed down in the last frame.
+ @discussion Presses are latched as they arrive, so a key that went down and back up between two flushes still reports true.
  */
 bool sapp_was_key_pressed(int key);
 /*!
@@ -84,8 +462,16 @@ bool sapp_was_key_pressed(int key);
  @param key The key code to check.
  @return True if the key was released in the last frame.
  @abstract Check if a key was released in the last frame.
+ @discussion Releases are latched as they arrive, so a key that went up and back down between two flushes still reports true.
  */
 bool sapp_was_key_released(int key);
+/*!
+ @function sapp_key_press_count
+ @param key The key code to check.
+ @return The number of times the key went down since the last flush (saturates at 255).
+ @abstract Count how many times a key was pressed in the last frame.
+ */
+int sapp_key_press_count(int key);
 /*!
  @function sapp_are_keys_down
  @param n The number of keys to check.
@@ -123,6 +509,13 @@ bool sapp_was_button_pressed(int button);
  @abstract Check if a mouse button was released in the last frame.
  */
 bool sapp_was_button_released(int button);
+/*!
+ @function sapp_button_press_count
+ @param button The mouse button to check.
+ @return The number of times the button went down since the last flush (saturates at 255).
+ @abstract Count how many times a mouse button was pressed in the last frame.
+ */
+int sapp_button_press_count(int button);
 /*!
  @function sapp_are_buttons_down
  @param n The number of buttons to check.
@@ -183,6 +576,46 @@ int sapp_cursor_delta_x(void);
  @abstract Get the change in y position of the mouse cursor since the last frame.
  */
 int sapp_cursor_delta_y(void);
+/*!
+ @function sapp_cursor_xf
+ @return The current x position of the mouse cursor with sub-pixel precision.
+ @abstract Get the current x position of the mouse cursor with sub-pixel precision.
+ @discussion With SOKOL_INPUT_FIXED_CURSOR defined the cursor is stored in fixed point with
+             1/SOKOL_INPUT_RECORD_SUBPIXEL pixel steps, so positions and deltas are bit-identical across machines.
+ */
+float sapp_cursor_xf(void);
+/*!
+ @function sapp_cursor_yf
+ @return The current y position of the mouse cursor with sub-pixel precision.
+ @abstract Get the current y position of the mouse cursor with sub-pixel precision.
+ */
+float sapp_cursor_yf(void);
+/*!
+ @function sapp_cursor_delta_xf
+ @return The change in x position of the mouse cursor since the last frame with sub-pixel precision.
+ @abstract Get the change in x position of the mouse cursor since the last frame with sub-pixel precision.
+ */
+float sapp_cursor_delta_xf(void);
+/*!
+ @function sapp_cursor_delta_yf
+ @return The change in y position of the mouse cursor since the last frame with sub-pixel precision.
+ @abstract Get the change in y position of the mouse cursor since the last frame with sub-pixel precision.
+ */
+float sapp_cursor_delta_yf(void);
+/*!
+ @function sapp_mouse_raw_dx
+ @return The relative x motion of the mouse since the last frame.
+ @abstract Get the relative x motion of the mouse since the last frame.
+ @discussion The sum of mouse_dx over every move event in the frame. Unlike sapp_cursor_delta_x this keeps
+             working while the mouse is locked and the cursor position no longer changes.
+ */
+float sapp_mouse_raw_dx(void);
+/*!
+ @function sapp_mouse_raw_dy
+ @return The relative y motion of the mouse since the last frame.
+ @abstract Get the relative y motion of the mouse since the last frame.
+ */
+float sapp_mouse_raw_dy(void);
 /*!
  @function sapp_was_mouse_scrolled
  @return True if the mouse wheel has been scrolled since the last frame.
@@ -193,106 +626,5024 @@ bool sapp_was_mouse_scrolled(void);
  @function sapp_scroll_x
  @return The amount the mouse wheel has been scrolled in the x direction since the last frame.
  @abstract Get the amount the mouse wheel has been scrolled in the x direction since the last frame.
+ @discussion This is the sum of every scroll event received since the last flush.
  */
 float sapp_scroll_x(void);
 /*!
  @function sapp_scroll_y
  @return The amount the mouse wheel has been scrolled in the y direction since the last frame.
  @abstract Get the amount the mouse wheel has been scrolled in the y direction since the last frame.
+ @discussion This is the sum of every scroll event received since the last flush.
  */
 float sapp_scroll_y(void);
+/*!
+ @function sapp_scroll_event_count
+ @return The number of scroll events received since the last frame.
+ @abstract Get the number of scroll events received since the last frame.
+ */
+int sapp_scroll_event_count(void);
+/*!
+ @function sapp_scroll_event
+ @param index The index of the scroll event, in the order they were received.
+ @param x Pointer to receive the x scroll amount of the event, can be NULL.
+ @param y Pointer to receive the y scroll amount of the event, can be NULL.
+ @return True if the event is available in the scroll history.
+ @abstract Get an individual scroll event from the last frame.
+ @discussion Only the first SOKOL_INPUT_SCROLL_HISTORY events of a frame are kept (default 16, define as 0 to disable).
+ */
+bool sapp_scroll_event(int index, float *x, float *y);
 
-#ifdef __cplusplus
-}
-#endif
-#endif // SOKOL_INPUT_HEADER
-
-#if defined(SOKOL_INPUT_IMPLEMENTATION) || defined(SOKOL_IMPL)
-#include <string.h>
-#include <stdint.h>
-#include <stddef.h>
-#include <assert.h>
-#include <stdlib.h>
-
-#ifndef SOKOL_KEY_HOLD_DELAY
-#define SOKOL_KEY_HOLD_DELAY 1.f
-#endif
-
-#define _MAX(A, B)    ((A) > (B) ? (A) : (B))
+/*!
+ @function sapp_input_records
+ @return An iterator over every event processed since the last frame, in order.
+ @abstract Iterate over the timestamped event records of the current frame.
+ @discussion Records are only kept when SOKOL_INPUT_EVENT_QUEUE_SIZE is defined to a non-zero capacity,
+             otherwise the iterator is always empty. The queue is a ring, so if more events than the capacity
+             arrive in one frame only the most recent ones are kept. Records are valid until the next sapp_input_flush.
+ */
+sapp_input_iter sapp_input_records(void);
+/*!
+ @function sapp_input_next_record
+ @param iter The iterator returned by sapp_input_records.
+ @return The next record, or NULL when there are no more records.
+ @abstract Advance a record iterator.
+ */
+const sapp_input_record* sapp_input_next_record(sapp_input_iter *iter);
+/*!
+ @function sapp_input_dropped_records
+ @return The number of records overwritten since the last frame because the queue was full.
+ @abstract Get the number of records lost to queue overflow in the current frame.
+ */
+int sapp_input_dropped_records(void);
 
-typedef struct {
-    bool keys[SAPP_KEYCODE_MENU+1];
-    bool buttons[3];
-    int modifier;
-    struct {
-        int x, y;
-    } cursor;
-    struct {
-        float x, y;
-    } scroll;
-} _state;
+/*!
+ @function sapp_input_set_threaded
+ @param enabled True to defer events to sapp_input_pump.
+ @abstract Hand events over to another thread instead of applying them immediately.
+ @discussion When enabled, sapp_input_event only pushes a record into a lock-free single-producer/single-consumer
+             ring and returns. The thread that owns the input state (and calls the query functions and sapp_input_flush)
+             applies them by calling sapp_input_pump at its own tick. The ring holds SOKOL_INPUT_PUMP_QUEUE_SIZE records
+             (default 256, must be a power of two); if the consumer falls behind, new events are dropped rather than
+             blocking the producer. Set this before events start arriving.
+ */
+void sapp_input_set_threaded(bool enabled);
+/*!
+ @function sapp_input_pump
+ @return The number of events applied.
+ @abstract Apply every event pushed by sapp_input_event since the last pump.
+ @discussion Must only be called from a single consumer thread. Does nothing unless sapp_input_set_threaded is enabled.
+ */
+int sapp_input_pump(void);
+/*!
+ @function sapp_input_pump_dropped
+ @return The total number of events dropped because the pump ring was full.
+ @abstract Get the number of events lost because sapp_input_pump was not called often enough.
+ */
+int sapp_input_pump_dropped(void);
 
-static struct {
-    _state input_prev, input_current;
-} _input_state;
+/*!
+ @function sapp_input_snapshot
+ @param out Pointer to receive the snapshot.
+ @abstract Take a consistent copy of the last flushed frame from any thread.
+ @discussion Every sapp_input_flush publishes the frame it completes through a sequence lock. Any number of reader
+             threads can call this concurrently with the thread that processes events and flushes; readers never
+             block the writer and only retry in the rare case a flush lands during their copy.
+ */
+void sapp_input_snapshot(sapp_input_state *out);
+/*!
+ @function sapp_state_is_key_down
+ @param state The snapshot to query.
+ @param key The key code to check.
+ @return True if the key was down at the end of the snapshot's frame.
+ @abstract Check if a key is down in a snapshot.
+ */
+bool sapp_state_is_key_down(const sapp_input_state *state, int key);
+/*!
+ @function sapp_state_was_key_pressed
+ @param state The snapshot to query.
+ @param key The key code to check.
+ @return True if the key went down during the snapshot's frame.
+ @abstract Check if a key was pressed in a snapshot.
+ */
+bool sapp_state_was_key_pressed(const sapp_input_state *state, int key);
+/*!
+ @function sapp_state_was_key_released
+ @param state The snapshot to query.
+ @param key The key code to check.
+ @return True if the key went up during the snapshot's frame.
+ @abstract Check if a key was released in a snapshot.
+ */
+bool sapp_state_was_key_released(const sapp_input_state *state, int key);
+/*!
+ @function sapp_state_is_button_down
+ @param state The snapshot to query.
+ @param button The mouse button to check.
+ @return True if the mouse button was down at the end of the snapshot's frame.
+ @abstract Check if a mouse button is down in a snapshot.
+ */
+bool sapp_state_is_button_down(const sapp_input_state *state, int button);
+/*!
+ @function sapp_state_was_button_pressed
+ @param state The snapshot to query.
+ @param button The mouse button to check.
+ @return True if the mouse button went down during the snapshot's frame.
+ @abstract Check if a mouse button was pressed in a snapshot.
+ */
+bool sapp_state_was_button_pressed(const sapp_input_state *state, int button);
+/*!
+ @function sapp_state_was_button_released
+ @param state The snapshot to query.
+ @param button The mouse button to check.
+ @return True if the mouse button went up during the snapshot's frame.
+ @abstract Check if a mouse button was released in a snapshot.
+ */
+bool sapp_state_was_button_released(const sapp_input_state *state, int button);
 
-void sapp_input_init(void) {
-    memset(&_input_state.input_prev,    0, sizeof(_state));
-    memset(&_input_state.input_current, 0, sizeof(_state));
-}
+/*!
+ @function sapp_input_start_recording
+ @param write Callback that receives the encoded recording in chunks.
+ @param user_data Pointer passed through to the callback.
+ @abstract Start recording every applied event and frame boundary into a compact binary stream.
+ @discussion Timestamps are delta encoded in microseconds, codes and modifiers as varints (modifiers only when they
+             change), cursor positions as zig-zag varint deltas quantized to 1/SOKOL_INPUT_RECORD_SUBPIXEL of a pixel
+             (default 16), and scroll amounts as raw floats, so most events take a handful of bytes. Output is buffered and
+             handed to the callback roughly every kilobyte, and when recording stops.
+             While recording, mouse and touch positions and raw mouse deltas are snapped to that grid before they are
+             applied, so the live session sees exactly what the replay will. Events applied before recording started
+             keep full float precision.
+ */
+void sapp_input_start_recording(sapp_input_write_func write, void *user_data);
+/*!
+ @function sapp_input_stop_recording
+ @abstract Stop recording and hand any buffered output to the write callback.
+ */
+void sapp_input_stop_recording(void);
+/*!
+ @function sapp_input_replay_init
+ @param replay The replay cursor to initialize.
+ @param data The recording, it must stay valid while the replay is in use.
+ @param size The size of the recording in bytes.
+ @return False if the data is not a recording.
+ @abstract Prepare to replay a recording made with sapp_input_start_recording.
+ */
+bool sapp_input_replay_init(sapp_input_replay *replay, const void *data, size_t size);
+/*!
+ @function sapp_input_replay_frame
+ @param replay The replay cursor.
+ @return False when the recording is exhausted or corrupt.
+ @abstract Apply the next recorded frame of events.
+ @discussion Applies every event up to the next recorded frame boundary, using the recorded timestamps, without
+             waiting for real time. Query the state as usual, then call sapp_input_flush to end the frame, just like
+             with live input. Events are applied directly even if sapp_input_set_threaded is enabled.
+ */
+bool sapp_input_replay_frame(sapp_input_replay *replay);
 
-void sapp_input_event(const sapp_event* e) {
-    switch (e->type) {
-        case SAPP_EVENTTYPE_KEY_UP:
-        case SAPP_EVENTTYPE_KEY_DOWN:
-            _input_state.input_current.keys[e->key_code] = e->type == SAPP_EVENTTYPE_KEY_DOWN;
-            _input_state.input_current.modifier = e->modifiers;
-            break;
-        case SAPP_EVENTTYPE_MOUSE_UP:
-        case SAPP_EVENTTYPE_MOUSE_DOWN:
-            _input_state.input_current.buttons[e->mouse_button] = e->type == SAPP_EVENTTYPE_MOUSE_DOWN;
-            break;
-        case SAPP_EVENTTYPE_MOUSE_MOVE:
-            _input_state.input_current.cursor.x = e->mouse_x;
-            _input_state.input_current.cursor.y = e->mouse_y;
-            break;
-        case SAPP_EVENTTYPE_MOUSE_SCROLL:
-            _input_state.input_current.scroll.x = e->scroll_x;
-            _input_state.input_current.scroll.y = e->scroll_y;
-            break;
-        default:
-            _input_state.input_current.modifier = e->modifiers;
-            break;
-    }
-}
+/*!
+ @function sapp_input_open_replay
+ @param path Path to a recording made with sapp_input_start_recording.
+ @param keyframe_interval Number of frames between keyframes, or 0 for SOKOL_INPUT_REPLAY_KEYFRAME_INTERVAL (default 600).
+ @return The opened replay, or NULL if the file could not be mapped or is not a recording.
+ @abstract Memory-map a recording for streaming replay and seeking.
+ @discussion The file is mapped rather than read, and frames are only decoded when they are replayed. While frames are
+             replayed, a snapshot of the input state is stored every keyframe_interval frames, so seeking to any frame
+             that has already been reached is a binary search plus at most keyframe_interval frames of re-simulation.
+             Like sapp_input_replay_frame, start from a context in the state it had when recording started.
+ */
+sapp_input_replay_file* sapp_input_open_replay(const char *path, int keyframe_interval);
+/*!
+ @function sapp_input_close_replay
+ @param file The replay to close.
+ @abstract Unmap a replay opened with sapp_input_open_replay and free its index.
+ */
+void sapp_input_close_replay(sapp_input_replay_file *file);
+/*!
+ @function sapp_input_replay_file_frame
+ @param file The replay.
+ @return False when the recording is exhausted or corrupt.
+ @abstract Apply the next frame of a mapped recording.
+ @discussion Works like sapp_input_replay_frame, call sapp_input_flush between frames.
+ */
+bool sapp_input_replay_file_frame(sapp_input_replay_file *file);
+/*!
+ @function sapp_input_seek_replay
+ @param file The replay.
+ @param frame The frame (counted from the start of the recording) to seek to.
+ @return False if the recording ends before that frame.
+ @abstract Restore the input state to the start of a recorded frame.
+ @discussion Afterwards the input state is identical to the live state right after the flush that preceded the frame,
+             and the next sapp_input_replay_file_frame applies that frame. The input history only reaches back
+             to the keyframe the seek started from.
+ */
+bool sapp_input_seek_replay(sapp_input_replay_file *file, uint64_t frame);
+/*!
+ @function sapp_input_replay_tell
+ @param file The replay.
+ @return The frame the next sapp_input_replay_file_frame will apply.
+ @abstract Get the current position of a mapped replay.
+ */
+uint64_t sapp_input_replay_tell(sapp_input_replay_file *file);
 
-void sapp_input_flush(void) {
-    memcpy(&_input_state.input_prev, &_input_state.input_current, sizeof(_state));
-    _input_state.input_current.scroll.x = _input_state.input_current.scroll.y = 0.f;
-}
+/*!
+ @function sapp_input_register_action
+ @param name The name of the action (up to 31 characters are kept).
+ @return The id of the action, or -1 if SOKOL_INPUT_MAX_ACTIONS (default 64) actions already exist.
+ @abstract Register a named action, or get the id of an existing action with the same name.
+ */
+int sapp_input_register_action(const char *name);
+/*!
+ @function sapp_input_find_action
+ @param name The name of the action.
+ @return The id of the action, or -1 if there is no such action.
+ @abstract Look up an action by name.
+ */
+int sapp_input_find_action(const char *name);
+/*!
+ @function sapp_input_bind_key
+ @param action The action id.
+ @param key The key code that triggers the action.
+ @param modifiers Modifier keys that must also be down (SAPP_MODIFIER_*), or 0.
+ @return False if the action is invalid or SOKOL_INPUT_MAX_BINDINGS (default 256) bindings already exist.
+ @abstract Bind a key to an action.
+ @discussion Bindings live in a fixed table, so they can be changed at any time without allocating.
+ */
+bool sapp_input_bind_key(int action, int key, int modifiers);
+/*!
+ @function sapp_input_bind_button
+ @param action The action id.
+ @param button The mouse button that triggers the action.
+ @param modifiers Modifier keys that must also be down (SAPP_MODIFIER_*), or 0.
+ @return False if the action is invalid or the binding table is full.
+ @abstract Bind a mouse button to an action.
+ */
+bool sapp_input_bind_button(int action, int button, int modifiers);
+/*!
+ @function sapp_input_unbind_action
+ @param action The action id.
+ @abstract Remove every binding of an action.
+ */
+void sapp_input_unbind_action(int action);
+/*!
+ @function sapp_action_down
+ @param action The action id.
+ @return True if any binding of the action is currently down.
+ @abstract Check if an action is currently active.
+ @discussion Bindings are evaluated once into an action bit set the first time an action is queried after
+             the key, button or modifier state changed, so every action query is a bit test.
+ */
+bool sapp_action_down(int action);
+/*!
+ @function sapp_action_pressed
+ @param action The action id.
+ @return True if the action became active in the last frame.
+ @abstract Check if an action was triggered in the last frame.
+ @discussion A bound key that was tapped within the frame also counts, even though it is no longer down.
+ */
+bool sapp_action_pressed(int action);
+/*!
+ @function sapp_action_released
+ @param action The action id.
+ @return True if the action stopped being active in the last frame.
+ @abstract Check if an action was released in the last frame.
+ */
+bool sapp_action_released(int action);
+/*!
+ @function sapp_input_add_virtual_axis
+ @param desc The actions, ramping and gamepad source of the axis.
+ @return The id of the axis, or -1 if SOKOL_INPUT_MAX_VIRTUAL_AXES (default 16) axes already exist.
+ @abstract Add an analog axis synthesized from two actions.
+ @discussion Reads see the current action and gamepad state: a press with sensitivity 0, a release with gravity 0
+             and a snapping reversal take effect at once. Ramps advance at sapp_input_flush, all axes together,
+             by the time since the previous flush.
+ */
+int sapp_input_add_virtual_axis(const sapp_virtual_axis_desc *desc);
+/*!
+ @function sapp_input_clear_virtual_axes
+ @abstract Remove every virtual axis.
+ */
+void sapp_input_clear_virtual_axes(void);
+/*!
+ @function sapp_virtual_axis
+ @param axis The axis id.
+ @return The axis value in -1..1, 0 for an invalid id.
+ @abstract Get a virtual axis.
+ */
+float sapp_virtual_axis(int axis);
+/*!
+ @function sapp_virtual_axes
+ @param count Receives the number of axes, may be NULL.
+ @return The values of every axis indexed by id, current until the input changes again.
+ @abstract Get all virtual axes at once.
+ */
+const float *sapp_virtual_axes(int *count);
 
-bool sapp_is_key_down(int key) {
-    return _input_state.input_current.keys[key];
-}
+/*!
+ @function sapp_chord_make
+ @param keys Array of key codes.
+ @param n The number of key codes in the array.
+ @return The chord, invalid key codes are ignored.
+ @abstract Compile a list of keys into a chord mask.
+ @discussion Build chords once and keep them; the chord queries then compare the whole key state against the mask
+             with a few SIMD operations instead of walking a va_list.
+ */
+sapp_chord sapp_chord_make(const int *keys, int n);
+/*!
+ @function sapp_chord_all_down
+ @param chord The chord to check.
+ @return True if every key of a non-empty chord is currently down.
+ @abstract Check if all the keys of a chord are down.
+ */
+bool sapp_chord_all_down(const sapp_chord *chord);
+/*!
+ @function sapp_chord_any_down
+ @param chord The chord to check.
+ @return True if any key of the chord is currently down.
+ @abstract Check if any of the keys of a chord are down.
+ */
+bool sapp_chord_any_down(const sapp_chord *chord);
+/*!
+ @function sapp_chord_pressed
+ @param chord The chord to check.
+ @return True if every key of the chord is down and at least one of them was pressed in the last frame.
+ @abstract Check if a chord was completed in the last frame.
+ */
+bool sapp_chord_pressed(const sapp_chord *chord);
 
-bool sapp_was_key_pressed(int key) {
-    return sapp_is_key_down(key) && !_input_state.input_prev.keys[key];
-}
+/*!
+ @function sapp_key_hold_time
+ @param key The key code to check.
+ @return The number of seconds the key has been held down, or 0 if it is up.
+ @abstract Get how long a key has been held down.
+ @discussion Input time advances with each processed event and with each sapp_input_flush, so during a frame
+             this is measured up to the end of the previous frame or the latest event, whichever is later.
+             Hold times are measured in microseconds and wrap after about 71 minutes.
+ */
+float sapp_key_hold_time(int key);
+/*!
+ @function sapp_is_key_held
+ @param key The key code to check.
+ @return True if the key has been down for at least SOKOL_KEY_HOLD_DELAY seconds (default 1).
+ @abstract Check if a key is being held.
+ */
+bool sapp_is_key_held(int key);
+/*!
+ @function sapp_was_key_hold_started
+ @param key The key code to check.
+ @return True if the key crossed the SOKOL_KEY_HOLD_DELAY threshold in the last frame.
+ @abstract Check if a key started being held in the last frame.
+ */
+bool sapp_was_key_hold_started(int key);
+/*!
+ @function sapp_button_hold_time
+ @param button The mouse button to check.
+ @return The number of seconds the mouse button has been held down, or 0 if it is up.
+ @abstract Get how long a mouse button has been held down.
+ */
+float sapp_button_hold_time(int button);
+/*!
+ @function sapp_is_button_held
+ @param button The mouse button to check.
+ @return True if the mouse button has been down for at least SOKOL_KEY_HOLD_DELAY seconds.
+ @abstract Check if a mouse button is being held.
+ */
+bool sapp_is_button_held(int button);
+/*!
+ @function sapp_was_button_hold_started
+ @param button The mouse button to check.
+ @return True if the mouse button crossed the SOKOL_KEY_HOLD_DELAY threshold in the last frame.
+ @abstract Check if a mouse button started being held in the last frame.
+ */
+bool sapp_was_button_hold_started(int button);
 
-bool sapp_was_key_released(int key) {
-    return !sapp_is_key_down(key) && _input_state.input_prev.keys[key];
-}
+/*!
+ @define SAPP_COMBO_BUTTON
+ @abstract Turn a mouse button into a combo step, combo steps are otherwise key codes.
+ */
+#define SAPP_COMBO_BUTTON(B) (512 + (B))
+/*!
+ @function sapp_input_register_combo
+ @param steps Array of key codes and SAPP_COMBO_BUTTON values to be pressed in order.
+ @param timeouts Optional array, timeouts[i] is the most seconds allowed between step i - 1 and step i (0 for no limit).
+                 Pass NULL to use SOKOL_INPUT_COMBO_TIMEOUT (default 0.25) for every step.
+ @param count The number of steps, up to SOKOL_INPUT_MAX_COMBO_STEPS (default 8).
+ @return The id of the combo, or -1 if the steps are invalid or the combo tables are full.
+ @abstract Register a press sequence, e.g. down, down + right, right, punch.
+ @discussion All combos are compiled into one Aho-Corasick automaton the next time a key or button is pressed,
+             so each press is a single table lookup no matter how many combos exist. Presses of keys that are
+             not part of any combo break every sequence in progress.
+ */
+int sapp_input_register_combo(const int *steps, const float *timeouts, int count);
+/*!
+ @function sapp_input_clear_combos
+ @abstract Remove every combo.
+ */
+void sapp_input_clear_combos(void);
+/*!
+ @function sapp_combo_triggered
+ @param combo The combo id.
+ @return True if the last step of the combo was pressed in the last frame, in time.
+ @abstract Check if a combo was completed in the last frame.
+ */
+bool sapp_combo_triggered(int combo);
+
+/*!
+ @function sapp_input_set_history_keys
+ @param keys Array of key codes to keep in the input history, or NULL to use the keys currently bound to actions.
+ @param n The number of keys in the array, up to 64.
+ @return False if there are more than 64 keys or a key code is invalid.
+ @abstract Choose the keys stored in the input history.
+ @discussion Each flush encodes the frame into a ring of the last SOKOL_INPUT_HISTORY_FRAMES (default 128) frames.
+             Changing the keys starts a new history, as earlier frames were encoded with a different key set.
+ */
+bool sapp_input_set_history_keys(const int *keys, int n);
+/*!
+ @function sapp_input_history_frame
+ @param frame The frame number, see sapp_input_state.frame.
+ @param out Receives the encoded frame.
+ @return False if the frame has not been flushed yet or is no longer in the history.
+ @abstract Fetch the compact encoding of a past frame.
+ */
+bool sapp_input_history_frame(uint64_t frame, sapp_input_frame *out);
+/*!
+ @function sapp_input_decode_frame
+ @param frame The encoded frame.
+ @param prev The encoded frame before it, or NULL.
+ @param out Receives the decoded frame.
+ @abstract Expand an encoded frame into a state that the sapp_state_ helpers can query.
+ @discussion Only the history keys are set. Edges and cursor movement are derived from prev, so taps that started
+             and ended within one frame are not represented.
+ */
+void sapp_input_decode_frame(const sapp_input_frame *frame, const sapp_input_frame *prev, sapp_input_state *out);
+/*!
+ @function sapp_input_frame_diff
+ @param a The first frame.
+ @param b The second frame.
+ @return The bitwise difference of the two encodings, zero keys and bits mean the frames hold the same input.
+ @abstract Compare two encoded frames, e.g. a predicted remote frame against the confirmed one.
+ */
+sapp_input_frame sapp_input_frame_diff(const sapp_input_frame *a, const sapp_input_frame *b);
+/*!
+ @function sapp_input_history_pack
+ @param first The first frame to pack.
+ @param count The number of frames to pack.
+ @param buffer The packet buffer.
+ @param size The size of the buffer, 16 + 17 * count bytes is always enough.
+ @return The number of bytes written, or 0 if a frame is not in the history or the buffer is too small.
+ @abstract Serialize a range of history frames into a network packet.
+ @discussion Frames are delta coded against the frame before them, a frame without changes takes one byte.
+ */
+size_t sapp_input_history_pack(uint64_t first, int count, void *buffer, size_t size);
+/*!
+ @function sapp_input_unpack_frames
+ @param data The packet data.
+ @param size The size of the packet.
+ @param out Receives the frames.
+ @param max The capacity of out.
+ @return The number of frames unpacked, or -1 if the packet is malformed or holds more than max frames.
+ @abstract Deserialize a packet made by sapp_input_history_pack.
+ */
+int sapp_input_unpack_frames(const void *data, size_t size, sapp_input_frame *out, int max);
+
+/*!
+ @function sapp_cursor_sample_count
+ @return The number of cursor samples kept, up to SOKOL_INPUT_MOTION_HISTORY (default 256, enough for the window at 8 kHz).
+ @abstract Get the number of mouse move samples in the motion history.
+ @discussion Every mouse move event is added to the history with its time, across frames.
+ */
+int sapp_cursor_sample_count(void);
+/*!
+ @function sapp_cursor_sample
+ @param index The index of the sample, 0 is the most recent.
+ @param time Receives the time of the sample in seconds, can be NULL.
+ @param x Receives the x position of the sample, can be NULL.
+ @param y Receives the y position of the sample, can be NULL.
+ @return False if the index is out of range.
+ @abstract Get a mouse move sample from the motion history.
+ */
+bool sapp_cursor_sample(int index, double *time, float *x, float *y);
+/*!
+ @function sapp_cursor_velocity
+ @param vx Receives the x velocity in pixels per second, can be NULL.
+ @param vy Receives the y velocity in pixels per second, can be NULL.
+ @abstract Get the current velocity of the cursor.
+ @discussion Velocity and acceleration come from an alpha-beta-gamma filter (a steady state Kalman filter) that is
+             updated with every sample and remembers about SOKOL_INPUT_MOTION_WINDOW seconds (default 0.03),
+             so high polling rate mice do not add noise. Both are zero once the cursor has not moved for
+             SOKOL_INPUT_MOTION_TIMEOUT seconds (default 0.1).
+ */
+void sapp_cursor_velocity(float *vx, float *vy);
+/*!
+ @function sapp_cursor_acceleration
+ @param ax Receives the x acceleration in pixels per second squared, can be NULL.
+ @param ay Receives the y acceleration in pixels per second squared, can be NULL.
+ @abstract Get the current acceleration of the cursor.
+ */
+void sapp_cursor_acceleration(float *ax, float *ay);
+/*!
+ @function sapp_cursor_predict
+ @param ms How far past the current input time to predict, e.g. the time until the frame is displayed.
+ @param mode SAPP_CURSOR_PREDICT_LINEAR or SAPP_CURSOR_PREDICT_FILTERED.
+ @param x Receives the predicted x position, can be NULL.
+ @param y Receives the predicted y position, can be NULL.
+ @abstract Predict where the cursor will be.
+ @discussion The linear mode averages the velocity over the samples of the last SOKOL_INPUT_MOTION_WINDOW seconds.
+ */
+void sapp_cursor_predict(float ms, int mode, float *x, float *y);
+
+/*!
+ @function sapp_touches_down
+ @return A mask with bit i set if touch slot i is down.
+ @abstract Get the touch slots that are currently down.
+ @discussion Touches are kept in SAPP_MAX_TOUCHPOINTS fixed slots. A touch keeps its slot from the event that
+             began it until the flush after it ended, so slot queries also work in the frame a touch ended.
+ */
+int sapp_touches_down(void);
+/*!
+ @function sapp_touches_began
+ @return A mask of the touch slots that began in the last frame.
+ @abstract Get the touches that began in the last frame.
+ */
+int sapp_touches_began(void);
+/*!
+ @function sapp_touches_moved
+ @return A mask of the touch slots that moved in the last frame.
+ @abstract Get the touches that moved in the last frame.
+ */
+int sapp_touches_moved(void);
+/*!
+ @function sapp_touches_ended
+ @return A mask of the touch slots that ended or were cancelled in the last frame.
+ @abstract Get the touches that ended in the last frame.
+ */
+int sapp_touches_ended(void);
+/*!
+ @function sapp_touches_cancelled
+ @return A mask of the touch slots that were cancelled in the last frame.
+ @abstract Get the touches that were cancelled in the last frame.
+ */
+int sapp_touches_cancelled(void);
+/*!
+ @function sapp_touch_count
+ @return The number of touches currently down.
+ @abstract Get the number of touches currently down.
+ */
+int sapp_touch_count(void);
+/*!
+ @function sapp_touch_find
+ @param identifier The sapp_touchpoint identifier.
+ @return The slot of the touch, or -1 if it is not tracked.
+ @abstract Find the slot of a touch by its identifier.
+ */
+int sapp_touch_find(uintptr_t identifier);
+/*!
+ @function sapp_touch_position
+ @param slot The touch slot.
+ @param x Receives the x position of the touch, can be NULL.
+ @param y Receives the y position of the touch, can be NULL.
+ @return False if the slot is not in use.
+ @abstract Get the current position of a touch.
+ */
+bool sapp_touch_position(int slot, float *x, float *y);
+/*!
+ @function sapp_touch_start
+ @param slot The touch slot.
+ @param x Receives the x position where the touch began, can be NULL.
+ @param y Receives the y position where the touch began, can be NULL.
+ @param time Receives the time the touch began in seconds since sapp_input_init, can be NULL.
+ @return False if the slot is not in use.
+ @abstract Get where and when a touch began.
+ */
+bool sapp_touch_start(int slot, float *x, float *y, double *time);
+
+/*!
+ @function sapp_input_gesture_config
+ @return The current gesture recognizer thresholds.
+ @abstract Get the gesture recognizer thresholds.
+ */
+sapp_gesture_config sapp_input_gesture_config(void);
+/*!
+ @function sapp_input_set_gesture_config
+ @param config The new thresholds.
+ @abstract Set the gesture recognizer thresholds.
+ */
+void sapp_input_set_gesture_config(const sapp_gesture_config *config);
+/*!
+ @function sapp_gesture_count
+ @return The number of gestures recognized since the last frame.
+ @abstract Get the number of gestures recognized since the last frame.
+ @discussion Gestures are recognized from touches and the left mouse button as each event arrives, using event
+             timestamps, so they do not depend on the frame rate. Consecutive changes of the same continuous
+             gesture are merged. Only the first SOKOL_INPUT_GESTURE_QUEUE (default 16) gestures of a frame are kept,
+             the last two slots are held back for gestures that end.
+ */
+int sapp_gesture_count(void);
+/*!
+ @function sapp_gesture_event
+ @param index The index of the gesture, 0 is the oldest.
+ @param out Receives the gesture.
+ @return False if the index is out of range.
+ @abstract Get a gesture recognized since the last frame.
+ */
+bool sapp_gesture_event(int index, sapp_gesture *out);
+/*!
+ @function sapp_was_gesture
+ @param type A SAPP_GESTURE_* type.
+ @return True if a gesture of this type was recognized since the last frame.
+ @abstract Check for a gesture type since the last frame.
+ */
+bool sapp_was_gesture(int type);
+
+/*!
+ @function sapp_input_set_gamepad_backend
+ @param backend The new backend, copied, or NULL to remove the current one.
+ @abstract Set the source of gamepad input.
+ @discussion The shutdown callback of the previous backend is called first and its gamepads are disconnected.
+             A backend is also removed by destroying its context, the default context never is, so remove it with
+             NULL before exiting.
+ */
+void sapp_input_set_gamepad_backend(const sapp_gamepad_backend *backend);
+/*!
+ @function sapp_input_poll_gamepads
+ @abstract Let the gamepad backend report changes since the last poll.
+ @discussion Call once per frame before sapp_input_flush. In threaded mode, poll from the thread that calls sapp_input_event.
+ */
+void sapp_input_poll_gamepads(void);
+/*!
+ @function sapp_input_gamepad_connect
+ @param gamepad The gamepad slot, 0 to SOKOL_INPUT_MAX_GAMEPADS (default 4) - 1.
+ @param connected True if the gamepad was connected, false if it was disconnected.
+ @abstract Report a gamepad being connected or disconnected.
+ @discussion Disconnecting releases its buttons and centers its axes. These functions are meant for gamepad
+             backends, they go through the same path as sapp_input_event so gamepad input is recorded and replayed.
+ */
+void sapp_input_gamepad_connect(int gamepad, bool connected);
+/*!
+ @function sapp_input_gamepad_button
+ @param gamepad The gamepad slot.
+ @param button A SAPP_GAMEPAD_BUTTON_* value, or any button below 32.
+ @param down True if the button was pressed, false if it was released.
+ @abstract Report a gamepad button change.
+ */
+void sapp_input_gamepad_button(int gamepad, int button, bool down);
+/*!
+ @function sapp_input_gamepad_axis
+ @param gamepad The gamepad slot.
+ @param axis A SAPP_GAMEPAD_AXIS_* value.
+ @param value The new axis value.
+ @abstract Report a gamepad axis change.
+ */
+void sapp_input_gamepad_axis(int gamepad, int axis, float value);
+/*!
+ @function sapp_gamepad_connected
+ @param gamepad The gamepad slot.
+ @return True if the gamepad is connected.
+ @abstract Check if a gamepad is connected.
+ */
+bool sapp_gamepad_connected(int gamepad);
+/*!
+ @function sapp_is_gamepad_button_down
+ @param gamepad The gamepad slot.
+ @param button A SAPP_GAMEPAD_BUTTON_* value.
+ @return True if the button is down.
+ @abstract Check if a gamepad button is down.
+ */
+bool sapp_is_gamepad_button_down(int gamepad, int button);
+/*!
+ @function sapp_was_gamepad_button_pressed
+ @param gamepad The gamepad slot.
+ @param button A SAPP_GAMEPAD_BUTTON_* value.
+ @return True if the button was pressed since the last frame.
+ @abstract Check if a gamepad button was pressed.
+ */
+bool sapp_was_gamepad_button_pressed(int gamepad, int button);
+/*!
+ @function sapp_was_gamepad_button_released
+ @param gamepad The gamepad slot.
+ @param button A SAPP_GAMEPAD_BUTTON_* value.
+ @return True if the button was released since the last frame.
+ @abstract Check if a gamepad button was released.
+ */
+bool sapp_was_gamepad_button_released(int gamepad, int button);
+/*!
+ @function sapp_gamepad_buttons
+ @param gamepad The gamepad slot.
+ @return The buttons that are down, bit b is button b.
+ @abstract Get all buttons of a gamepad at once.
+ */
+uint32_t sapp_gamepad_buttons(int gamepad);
+/*!
+ @function sapp_gamepad_axis
+ @param gamepad The gamepad slot.
+ @param axis A SAPP_GAMEPAD_AXIS_* value.
+ @return The axis value after the deadzone and response curve, 0 if the gamepad is not connected.
+ @abstract Get a gamepad axis.
+ @discussion Every axis of every gamepad is processed in one pass the first time an axis is read after a change,
+             so all systems see the same values. Stick magnitudes never exceed 1.
+ */
+float sapp_gamepad_axis(int gamepad, int axis);
+/*!
+ @function sapp_gamepad_axis_raw
+ @param gamepad The gamepad slot.
+ @param axis A SAPP_GAMEPAD_AXIS_* value.
+ @return The axis value as the backend reported it.
+ @abstract Get a gamepad axis without processing.
+ */
+float sapp_gamepad_axis_raw(int gamepad, int axis);
+/*!
+ @function sapp_input_gamepad_response
+ @param group A SAPP_GAMEPAD_RESPONSE_* value.
+ @return The response of the axis group.
+ @abstract Get how an axis group is processed.
+ */
+sapp_gamepad_response sapp_input_gamepad_response(int group);
+/*!
+ @function sapp_input_set_gamepad_response
+ @param group A SAPP_GAMEPAD_RESPONSE_* value.
+ @param response The new response, shared by every gamepad.
+ @abstract Set how an axis group is processed.
+ */
+void sapp_input_set_gamepad_response(int group, const sapp_gamepad_response *response);
+
+#if defined(__linux__) && !defined(SOKOL_INPUT_NO_EVDEV)
+/*!
+ @function sapp_input_open_evdev
+ @param directory The directory to scan and watch, NULL for /dev/input.
+ @return False if the directory could not be read.
+ @abstract Read gamepads from Linux evdev devices.
+ @discussion Installs the evdev gamepad backend, opens every event* device in the directory that reports gamepad
+             or joystick buttons and watches the directory with inotify so gamepads are connected and disconnected
+             as they are plugged in. Devices are read with non-blocking batched reads in sapp_input_poll_gamepads.
+             Files whose capabilities cannot be queried (regular files, FIFOs) are assumed to be gamepads.
+             Define SOKOL_INPUT_NO_EVDEV to leave the backend out.
+ */
+bool sapp_input_open_evdev(const char *directory);
+/*!
+ @function sapp_input_evdev_add_device
+ @param path An evdev device, or a file or FIFO of recorded struct input_event records.
+ @return The gamepad slot of the device, or -1 if it could not be opened or every slot is in use.
+ @abstract Read a single device with the evdev gamepad backend.
+ @discussion Installs the evdev backend like sapp_input_open_evdev but skips the capability check, for headless tests.
+ */
+int sapp_input_evdev_add_device(const char *path);
+#endif
+
+/*!
+ @function sapp_input_add_gamepad_mappings
+ @param mappings Lines in the SDL_GameControllerDB (gamecontrollerdb.txt) format.
+ @param length The length of the text, or 0 if it is null terminated.
+ @return The number of mappings added, or -1 if memory ran out.
+ @abstract Load gamepad mappings.
+ @discussion Mappings are keyed by the device GUID, a later mapping for the same GUID replaces the earlier one.
+             Lines for other platforms are skipped. Backends look mappings up once when a gamepad connects,
+             the evdev backend uses them to route each device's buttons and axes to the standard layout.
+ */
+int sapp_input_add_gamepad_mappings(const char *mappings, size_t length);
+/*!
+ @function sapp_input_clear_gamepad_mappings
+ @abstract Remove all gamepad mappings and free their memory.
+ */
+void sapp_input_clear_gamepad_mappings(void);
+/*!
+ @function sapp_input_has_gamepad_mapping
+ @param guid The device GUID as 32 hex digits, as in the first column of gamecontrollerdb.txt.
+ @return True if a mapping for the device is loaded.
+ @abstract Check for a gamepad mapping.
+ */
+bool sapp_input_has_gamepad_mapping(const char *guid);
+
+/*!
+ @function sapp_input_create_context
+ @return A new, initialized input context, or NULL if allocation failed.
+ @abstract Create an independent input context.
+ @discussion Memory is allocated with SOKOL_INPUT_MALLOC (defaults to malloc).
+ */
+sapp_input_context* sapp_input_create_context(void);
+/*!
+ @function sapp_input_destroy_context
+ @param ctx The context to destroy.
+ @abstract Destroy a context created with sapp_input_create_context.
+ */
+void sapp_input_destroy_context(sapp_input_context *ctx);
+/*!
+ @function sapp_input_default_context
+ @return The context used by the functions without a ctx parameter.
+ @abstract Get the default input context.
+ */
+sapp_input_context* sapp_input_default_context(void);
+/*!
+ @function sapp_ctx_input_init
+ @abstract Context variant of sapp_input_init.
+ */
+void sapp_ctx_input_init(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_event
+ @abstract Context variant of sapp_input_event.
+ */
+void sapp_ctx_input_event(sapp_input_context *ctx, const sapp_event* e);
+/*!
+ @function sapp_ctx_input_flush
+ @abstract Context variant of sapp_input_flush.
+ */
+void sapp_ctx_input_flush(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_is_key_down
+ @abstract Context variant of sapp_is_key_down.
+ */
+bool sapp_ctx_is_key_down(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_was_key_pressed
+ @abstract Context variant of sapp_was_key_pressed.
+ */
+bool sapp_ctx_was_key_pressed(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_was_key_released
+ @abstract Context variant of sapp_was_key_released.
+ */
+bool sapp_ctx_was_key_released(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_key_press_count
+ @abstract Context variant of sapp_key_press_count.
+ */
+int sapp_ctx_key_press_count(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_are_keys_down
+ @abstract Context variant of sapp_are_keys_down.
+ */
+bool sapp_ctx_are_keys_down(sapp_input_context *ctx, int n, ...);
+/*!
+ @function sapp_ctx_any_keys_down
+ @abstract Context variant of sapp_any_keys_down.
+ */
+bool sapp_ctx_any_keys_down(sapp_input_context *ctx, int n, ...);
+/*!
+ @function sapp_ctx_is_button_down
+ @abstract Context variant of sapp_is_button_down.
+ */
+bool sapp_ctx_is_button_down(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_was_button_pressed
+ @abstract Context variant of sapp_was_button_pressed.
+ */
+bool sapp_ctx_was_button_pressed(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_was_button_released
+ @abstract Context variant of sapp_was_button_released.
+ */
+bool sapp_ctx_was_button_released(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_button_press_count
+ @abstract Context variant of sapp_button_press_count.
+ */
+int sapp_ctx_button_press_count(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_are_buttons_down
+ @abstract Context variant of sapp_are_buttons_down.
+ */
+bool sapp_ctx_are_buttons_down(sapp_input_context *ctx, int n, ...);
+/*!
+ @function sapp_ctx_any_buttons_down
+ @abstract Context variant of sapp_any_buttons_down.
+ */
+bool sapp_ctx_any_buttons_down(sapp_input_context *ctx, int n, ...);
+/*!
+ @function sapp_ctx_modifier_equals
+ @abstract Context variant of sapp_modifier_equals.
+ */
+bool sapp_ctx_modifier_equals(sapp_input_context *ctx, int mods);
+/*!
+ @function sapp_ctx_modifier_down
+ @abstract Context variant of sapp_modifier_down.
+ */
+bool sapp_ctx_modifier_down(sapp_input_context *ctx, int mod);
+/*!
+ @function sapp_ctx_has_mouse_move
+ @abstract Context variant of sapp_has_mouse_move.
+ */
+bool sapp_ctx_has_mouse_move(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_x
+ @abstract Context variant of sapp_cursor_x.
+ */
+int sapp_ctx_cursor_x(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_y
+ @abstract Context variant of sapp_cursor_y.
+ */
+int sapp_ctx_cursor_y(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_delta_x
+ @abstract Context variant of sapp_cursor_delta_x.
+ */
+int sapp_ctx_cursor_delta_x(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_delta_y
+ @abstract Context variant of sapp_cursor_delta_y.
+ */
+int sapp_ctx_cursor_delta_y(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_xf
+ @abstract Context variant of sapp_cursor_xf.
+ */
+float sapp_ctx_cursor_xf(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_yf
+ @abstract Context variant of sapp_cursor_yf.
+ */
+float sapp_ctx_cursor_yf(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_delta_xf
+ @abstract Context variant of sapp_cursor_delta_xf.
+ */
+float sapp_ctx_cursor_delta_xf(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_delta_yf
+ @abstract Context variant of sapp_cursor_delta_yf.
+ */
+float sapp_ctx_cursor_delta_yf(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_mouse_raw_dx
+ @abstract Context variant of sapp_mouse_raw_dx.
+ */
+float sapp_ctx_mouse_raw_dx(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_mouse_raw_dy
+ @abstract Context variant of sapp_mouse_raw_dy.
+ */
+float sapp_ctx_mouse_raw_dy(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_was_mouse_scrolled
+ @abstract Context variant of sapp_was_mouse_scrolled.
+ */
+bool sapp_ctx_was_mouse_scrolled(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_scroll_x
+ @abstract Context variant of sapp_scroll_x.
+ */
+float sapp_ctx_scroll_x(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_scroll_y
+ @abstract Context variant of sapp_scroll_y.
+ */
+float sapp_ctx_scroll_y(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_scroll_event_count
+ @abstract Context variant of sapp_scroll_event_count.
+ */
+int sapp_ctx_scroll_event_count(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_scroll_event
+ @abstract Context variant of sapp_scroll_event.
+ */
+bool sapp_ctx_scroll_event(sapp_input_context *ctx, int index, float *x, float *y);
+/*!
+ @function sapp_ctx_input_records
+ @abstract Context variant of sapp_input_records.
+ */
+sapp_input_iter sapp_ctx_input_records(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_next_record
+ @abstract Context variant of sapp_input_next_record.
+ */
+const sapp_input_record* sapp_ctx_input_next_record(sapp_input_context *ctx, sapp_input_iter *iter);
+/*!
+ @function sapp_ctx_input_dropped_records
+ @abstract Context variant of sapp_input_dropped_records.
+ */
+int sapp_ctx_input_dropped_records(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_set_threaded
+ @abstract Context variant of sapp_input_set_threaded.
+ */
+void sapp_ctx_input_set_threaded(sapp_input_context *ctx, bool enabled);
+/*!
+ @function sapp_ctx_input_pump
+ @abstract Context variant of sapp_input_pump.
+ */
+int sapp_ctx_input_pump(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_pump_dropped
+ @abstract Context variant of sapp_input_pump_dropped.
+ */
+int sapp_ctx_input_pump_dropped(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_snapshot
+ @abstract Context variant of sapp_input_snapshot.
+ */
+void sapp_ctx_input_snapshot(sapp_input_context *ctx, sapp_input_state *out);
+/*!
+ @function sapp_ctx_input_start_recording
+ @abstract Context variant of sapp_input_start_recording.
+ */
+void sapp_ctx_input_start_recording(sapp_input_context *ctx, sapp_input_write_func write, void *user_data);
+/*!
+ @function sapp_ctx_input_stop_recording
+ @abstract Context variant of sapp_input_stop_recording.
+ */
+void sapp_ctx_input_stop_recording(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_replay_frame
+ @abstract Context variant of sapp_input_replay_frame.
+ */
+bool sapp_ctx_input_replay_frame(sapp_input_context *ctx, sapp_input_replay *replay);
+/*!
+ @function sapp_ctx_input_replay_file_frame
+ @abstract Context variant of sapp_input_replay_file_frame.
+ */
+bool sapp_ctx_input_replay_file_frame(sapp_input_context *ctx, sapp_input_replay_file *file);
+/*!
+ @function sapp_ctx_input_seek_replay
+ @abstract Context variant of sapp_input_seek_replay.
+ */
+bool sapp_ctx_input_seek_replay(sapp_input_context *ctx, sapp_input_replay_file *file, uint64_t frame);
+/*!
+ @function sapp_ctx_input_register_action
+ @abstract Context variant of sapp_input_register_action.
+ */
+int sapp_ctx_input_register_action(sapp_input_context *ctx, const char *name);
+/*!
+ @function sapp_ctx_input_find_action
+ @abstract Context variant of sapp_input_find_action.
+ */
+int sapp_ctx_input_find_action(sapp_input_context *ctx, const char *name);
+/*!
+ @function sapp_ctx_input_bind_key
+ @abstract Context variant of sapp_input_bind_key.
+ */
+bool sapp_ctx_input_bind_key(sapp_input_context *ctx, int action, int key, int modifiers);
+/*!
+ @function sapp_ctx_input_bind_button
+ @abstract Context variant of sapp_input_bind_button.
+ */
+bool sapp_ctx_input_bind_button(sapp_input_context *ctx, int action, int button, int modifiers);
+/*!
+ @function sapp_ctx_input_unbind_action
+ @abstract Context variant of sapp_input_unbind_action.
+ */
+void sapp_ctx_input_unbind_action(sapp_input_context *ctx, int action);
+/*!
+ @function sapp_ctx_action_down
+ @abstract Context variant of sapp_action_down.
+ */
+bool sapp_ctx_action_down(sapp_input_context *ctx, int action);
+/*!
+ @function sapp_ctx_action_pressed
+ @abstract Context variant of sapp_action_pressed.
+ */
+bool sapp_ctx_action_pressed(sapp_input_context *ctx, int action);
+/*!
+ @function sapp_ctx_action_released
+ @abstract Context variant of sapp_action_released.
+ */
+bool sapp_ctx_action_released(sapp_input_context *ctx, int action);
+/*!
+ @function sapp_ctx_input_add_virtual_axis
+ @abstract Context variant of sapp_input_add_virtual_axis.
+ */
+int sapp_ctx_input_add_virtual_axis(sapp_input_context *ctx, const sapp_virtual_axis_desc *desc);
+/*!
+ @function sapp_ctx_input_clear_virtual_axes
+ @abstract Context variant of sapp_input_clear_virtual_axes.
+ */
+void sapp_ctx_input_clear_virtual_axes(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_virtual_axis
+ @abstract Context variant of sapp_virtual_axis.
+ */
+float sapp_ctx_virtual_axis(sapp_input_context *ctx, int axis);
+/*!
+ @function sapp_ctx_virtual_axes
+ @abstract Context variant of sapp_virtual_axes.
+ */
+const float *sapp_ctx_virtual_axes(sapp_input_context *ctx, int *count);
+/*!
+ @function sapp_ctx_chord_all_down
+ @abstract Context variant of sapp_chord_all_down.
+ */
+bool sapp_ctx_chord_all_down(sapp_input_context *ctx, const sapp_chord *chord);
+/*!
+ @function sapp_ctx_chord_any_down
+ @abstract Context variant of sapp_chord_any_down.
+ */
+bool sapp_ctx_chord_any_down(sapp_input_context *ctx, const sapp_chord *chord);
+/*!
+ @function sapp_ctx_chord_pressed
+ @abstract Context variant of sapp_chord_pressed.
+ */
+bool sapp_ctx_chord_pressed(sapp_input_context *ctx, const sapp_chord *chord);
+/*!
+ @function sapp_ctx_key_hold_time
+ @abstract Context variant of sapp_key_hold_time.
+ */
+float sapp_ctx_key_hold_time(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_is_key_held
+ @abstract Context variant of sapp_is_key_held.
+ */
+bool sapp_ctx_is_key_held(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_was_key_hold_started
+ @abstract Context variant of sapp_was_key_hold_started.
+ */
+bool sapp_ctx_was_key_hold_started(sapp_input_context *ctx, int key);
+/*!
+ @function sapp_ctx_button_hold_time
+ @abstract Context variant of sapp_button_hold_time.
+ */
+float sapp_ctx_button_hold_time(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_is_button_held
+ @abstract Context variant of sapp_is_button_held.
+ */
+bool sapp_ctx_is_button_held(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_was_button_hold_started
+ @abstract Context variant of sapp_was_button_hold_started.
+ */
+bool sapp_ctx_was_button_hold_started(sapp_input_context *ctx, int button);
+/*!
+ @function sapp_ctx_input_register_combo
+ @abstract Context variant of sapp_input_register_combo.
+ */
+int sapp_ctx_input_register_combo(sapp_input_context *ctx, const int *steps, const float *timeouts, int count);
+/*!
+ @function sapp_ctx_input_clear_combos
+ @abstract Context variant of sapp_input_clear_combos.
+ */
+void sapp_ctx_input_clear_combos(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_combo_triggered
+ @abstract Context variant of sapp_combo_triggered.
+ */
+bool sapp_ctx_combo_triggered(sapp_input_context *ctx, int combo);
+/*!
+ @function sapp_ctx_input_set_history_keys
+ @abstract Context variant of sapp_input_set_history_keys.
+ */
+bool sapp_ctx_input_set_history_keys(sapp_input_context *ctx, const int *keys, int n);
+/*!
+ @function sapp_ctx_input_history_frame
+ @abstract Context variant of sapp_input_history_frame.
+ */
+bool sapp_ctx_input_history_frame(sapp_input_context *ctx, uint64_t frame, sapp_input_frame *out);
+/*!
+ @function sapp_ctx_input_decode_frame
+ @abstract Context variant of sapp_input_decode_frame.
+ */
+void sapp_ctx_input_decode_frame(sapp_input_context *ctx, const sapp_input_frame *frame, const sapp_input_frame *prev, sapp_input_state *out);
+/*!
+ @function sapp_ctx_input_history_pack
+ @abstract Context variant of sapp_input_history_pack.
+ */
+size_t sapp_ctx_input_history_pack(sapp_input_context *ctx, uint64_t first, int count, void *buffer, size_t size);
+/*!
+ @function sapp_ctx_cursor_sample_count
+ @abstract Context variant of sapp_cursor_sample_count.
+ */
+int sapp_ctx_cursor_sample_count(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_cursor_sample
+ @abstract Context variant of sapp_cursor_sample.
+ */
+bool sapp_ctx_cursor_sample(sapp_input_context *ctx, int index, double *time, float *x, float *y);
+/*!
+ @function sapp_ctx_cursor_velocity
+ @abstract Context variant of sapp_cursor_velocity.
+ */
+void sapp_ctx_cursor_velocity(sapp_input_context *ctx, float *vx, float *vy);
+/*!
+ @function sapp_ctx_cursor_acceleration
+ @abstract Context variant of sapp_cursor_acceleration.
+ */
+void sapp_ctx_cursor_acceleration(sapp_input_context *ctx, float *ax, float *ay);
+/*!
+ @function sapp_ctx_cursor_predict
+ @abstract Context variant of sapp_cursor_predict.
+ */
+void sapp_ctx_cursor_predict(sapp_input_context *ctx, float ms, int mode, float *x, float *y);
+/*!
+ @function sapp_ctx_touches_down
+ @abstract Context variant of sapp_touches_down.
+ */
+int sapp_ctx_touches_down(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_touches_began
+ @abstract Context variant of sapp_touches_began.
+ */
+int sapp_ctx_touches_began(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_touches_moved
+ @abstract Context variant of sapp_touches_moved.
+ */
+int sapp_ctx_touches_moved(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_touches_ended
+ @abstract Context variant of sapp_touches_ended.
+ */
+int sapp_ctx_touches_ended(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_touches_cancelled
+ @abstract Context variant of sapp_touches_cancelled.
+ */
+int sapp_ctx_touches_cancelled(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_touch_count
+ @abstract Context variant of sapp_touch_count.
+ */
+int sapp_ctx_touch_count(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_touch_find
+ @abstract Context variant of sapp_touch_find.
+ */
+int sapp_ctx_touch_find(sapp_input_context *ctx, uintptr_t identifier);
+/*!
+ @function sapp_ctx_touch_position
+ @abstract Context variant of sapp_touch_position.
+ */
+bool sapp_ctx_touch_position(sapp_input_context *ctx, int slot, float *x, float *y);
+/*!
+ @function sapp_ctx_touch_start
+ @abstract Context variant of sapp_touch_start.
+ */
+bool sapp_ctx_touch_start(sapp_input_context *ctx, int slot, float *x, float *y, double *time);
+/*!
+ @function sapp_ctx_input_gesture_config
+ @abstract Context variant of sapp_input_gesture_config.
+ */
+sapp_gesture_config sapp_ctx_input_gesture_config(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_set_gesture_config
+ @abstract Context variant of sapp_input_set_gesture_config.
+ */
+void sapp_ctx_input_set_gesture_config(sapp_input_context *ctx, const sapp_gesture_config *config);
+/*!
+ @function sapp_ctx_gesture_count
+ @abstract Context variant of sapp_gesture_count.
+ */
+int sapp_ctx_gesture_count(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_gesture_event
+ @abstract Context variant of sapp_gesture_event.
+ */
+bool sapp_ctx_gesture_event(sapp_input_context *ctx, int index, sapp_gesture *out);
+/*!
+ @function sapp_ctx_was_gesture
+ @abstract Context variant of sapp_was_gesture.
+ */
+bool sapp_ctx_was_gesture(sapp_input_context *ctx, int type);
+
+/*!
+ @function sapp_ctx_input_set_gamepad_backend
+ @abstract Context variant of sapp_input_set_gamepad_backend.
+ */
+void sapp_ctx_input_set_gamepad_backend(sapp_input_context *ctx, const sapp_gamepad_backend *backend);
+/*!
+ @function sapp_ctx_input_poll_gamepads
+ @abstract Context variant of sapp_input_poll_gamepads.
+ */
+void sapp_ctx_input_poll_gamepads(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_gamepad_connect
+ @abstract Context variant of sapp_input_gamepad_connect.
+ */
+void sapp_ctx_input_gamepad_connect(sapp_input_context *ctx, int gamepad, bool connected);
+/*!
+ @function sapp_ctx_input_gamepad_button
+ @abstract Context variant of sapp_input_gamepad_button.
+ */
+void sapp_ctx_input_gamepad_button(sapp_input_context *ctx, int gamepad, int button, bool down);
+/*!
+ @function sapp_ctx_input_gamepad_axis
+ @abstract Context variant of sapp_input_gamepad_axis.
+ */
+void sapp_ctx_input_gamepad_axis(sapp_input_context *ctx, int gamepad, int axis, float value);
+/*!
+ @function sapp_ctx_gamepad_connected
+ @abstract Context variant of sapp_gamepad_connected.
+ */
+bool sapp_ctx_gamepad_connected(sapp_input_context *ctx, int gamepad);
+/*!
+ @function sapp_ctx_is_gamepad_button_down
+ @abstract Context variant of sapp_is_gamepad_button_down.
+ */
+bool sapp_ctx_is_gamepad_button_down(sapp_input_context *ctx, int gamepad, int button);
+/*!
+ @function sapp_ctx_was_gamepad_button_pressed
+ @abstract Context variant of sapp_was_gamepad_button_pressed.
+ */
+bool sapp_ctx_was_gamepad_button_pressed(sapp_input_context *ctx, int gamepad, int button);
+/*!
+ @function sapp_ctx_was_gamepad_button_released
+ @abstract Context variant of sapp_was_gamepad_button_released.
+ */
+bool sapp_ctx_was_gamepad_button_released(sapp_input_context *ctx, int gamepad, int button);
+/*!
+ @function sapp_ctx_gamepad_buttons
+ @abstract Context variant of sapp_gamepad_buttons.
+ */
+uint32_t sapp_ctx_gamepad_buttons(sapp_input_context *ctx, int gamepad);
+/*!
+ @function sapp_ctx_gamepad_axis
+ @abstract Context variant of sapp_gamepad_axis.
+ */
+float sapp_ctx_gamepad_axis(sapp_input_context *ctx, int gamepad, int axis);
+
+#if defined(__linux__) && !defined(SOKOL_INPUT_NO_EVDEV)
+/*!
+ @function sapp_ctx_input_open_evdev
+ @abstract Context variant of sapp_input_open_evdev.
+ */
+bool sapp_ctx_input_open_evdev(sapp_input_context *ctx, const char *directory);
+/*!
+ @function sapp_ctx_input_evdev_add_device
+ @abstract Context variant of sapp_input_evdev_add_device.
+ */
+int sapp_ctx_input_evdev_add_device(sapp_input_context *ctx, const char *path);
+#endif
+
+/*!
+ @function sapp_ctx_input_add_gamepad_mappings
+ @abstract Context variant of sapp_input_add_gamepad_mappings.
+ */
+int sapp_ctx_input_add_gamepad_mappings(sapp_input_context *ctx, const char *mappings, size_t length);
+/*!
+ @function sapp_ctx_input_clear_gamepad_mappings
+ @abstract Context variant of sapp_input_clear_gamepad_mappings.
+ */
+void sapp_ctx_input_clear_gamepad_mappings(sapp_input_context *ctx);
+/*!
+ @function sapp_ctx_input_has_gamepad_mapping
+ @abstract Context variant of sapp_input_has_gamepad_mapping.
+ */
+bool sapp_ctx_input_has_gamepad_mapping(sapp_input_context *ctx, const char *guid);
+
+/*!
+ @function sapp_ctx_gamepad_axis_raw
+ @abstract Context variant of sapp_gamepad_axis_raw.
+ */
+float sapp_ctx_gamepad_axis_raw(sapp_input_context *ctx, int gamepad, int axis);
+/*!
+ @function sapp_ctx_input_gamepad_response
+ @abstract Context variant of sapp_input_gamepad_response.
+ */
+sapp_gamepad_response sapp_ctx_input_gamepad_response(sapp_input_context *ctx, int group);
+/*!
+ @function sapp_ctx_input_set_gamepad_response
+ @abstract Context variant of sapp_input_set_gamepad_response.
+ */
+void sapp_ctx_input_set_gamepad_response(sapp_input_context *ctx, int group, const sapp_gamepad_response *response);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // SOKOL_INPUT_HEADER
+
+#if defined(SOKOL_INPUT_IMPLEMENTATION) || defined(SOKOL_IMPL)
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+#include <stdlib.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#endif
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#if defined(__linux__) && !defined(SOKOL_INPUT_NO_EVDEV)
+#define _INPUT_EVDEV
+#include <errno.h>
+#include <dirent.h>
+#include <sys/ioctl.h>
+#include <sys/inotify.h>
+#include <linux/input.h>
+#endif
+
+#ifndef SOKOL_KEY_HOLD_DELAY
+#define SOKOL_KEY_HOLD_DELAY 1.f
+#endif
+
+#ifndef SOKOL_INPUT_SCROLL_HISTORY
+#define SOKOL_INPUT_SCROLL_HISTORY 16
+#endif
+
+#ifndef SOKOL_INPUT_EVENT_QUEUE_SIZE
+#define SOKOL_INPUT_EVENT_QUEUE_SIZE 0
+#endif
+
+#ifndef SOKOL_INPUT_PUMP_QUEUE_SIZE
+#define SOKOL_INPUT_PUMP_QUEUE_SIZE 256
+#endif
+#if (SOKOL_INPUT_PUMP_QUEUE_SIZE & (SOKOL_INPUT_PUMP_QUEUE_SIZE - 1)) != 0
+#error SOKOL_INPUT_PUMP_QUEUE_SIZE must be a power of two
+#endif
+
+#ifndef SOKOL_INPUT_MOTION_HISTORY
+#define SOKOL_INPUT_MOTION_HISTORY 256
+#endif
+#ifndef SOKOL_INPUT_MOTION_WINDOW
+#define SOKOL_INPUT_MOTION_WINDOW .03f
+#endif
+#ifndef SOKOL_INPUT_MOTION_TIMEOUT
+#define SOKOL_INPUT_MOTION_TIMEOUT .1f
+#endif
+
+#if SOKOL_INPUT_MOTION_HISTORY < 2 || (SOKOL_INPUT_MOTION_HISTORY & (SOKOL_INPUT_MOTION_HISTORY - 1)) != 0
+#error SOKOL_INPUT_MOTION_HISTORY must be a power of two of at least 2
+#endif
+
+#ifndef SOKOL_INPUT_GESTURE_QUEUE
+#define SOKOL_INPUT_GESTURE_QUEUE 16
+#endif
+// Slots only ENDED phases may take, enough for a pinch and a rotation ending together
+#define _INPUT_GESTURE_END_RESERVE 2
+#if SOKOL_INPUT_GESTURE_QUEUE <= _INPUT_GESTURE_END_RESERVE
+#error SOKOL_INPUT_GESTURE_QUEUE must be greater than 2
+#endif
+
+#ifndef SOKOL_INPUT_HISTORY_FRAMES
+#define SOKOL_INPUT_HISTORY_FRAMES 128
+#endif
+
+#ifndef SOKOL_INPUT_MAX_GAMEPADS
+#define SOKOL_INPUT_MAX_GAMEPADS 4
+#endif
+#if SOKOL_INPUT_MAX_GAMEPADS < 1 || SOKOL_INPUT_MAX_GAMEPADS > 8
+#error SOKOL_INPUT_MAX_GAMEPADS must be between 1 and 8
+#endif
+// Axis rows are padded to whole 4-lane vectors
+#define _INPUT_GAMEPAD_LANES ((SOKOL_INPUT_MAX_GAMEPADS + 3) & ~3)
+
+#if SOKOL_INPUT_HISTORY_FRAMES < 1 || (SOKOL_INPUT_HISTORY_FRAMES & (SOKOL_INPUT_HISTORY_FRAMES - 1)) != 0
+#error SOKOL_INPUT_HISTORY_FRAMES must be a power of two
+#endif
+
+#ifndef SOKOL_INPUT_RECORD_SUBPIXEL
+#define SOKOL_INPUT_RECORD_SUBPIXEL 16
+#endif
+
+#ifndef SOKOL_INPUT_REPLAY_KEYFRAME_INTERVAL
+#define SOKOL_INPUT_REPLAY_KEYFRAME_INTERVAL 600
+#endif
+
+#ifndef SOKOL_INPUT_MAX_ACTIONS
+#define SOKOL_INPUT_MAX_ACTIONS 64
+#endif
+#ifndef SOKOL_INPUT_MAX_BINDINGS
+#define SOKOL_INPUT_MAX_BINDINGS 256
+#endif
+#ifndef SOKOL_INPUT_MAX_VIRTUAL_AXES
+#define SOKOL_INPUT_MAX_VIRTUAL_AXES 16
+#endif
+
+#ifndef SOKOL_INPUT_MAX_COMBOS
+#define SOKOL_INPUT_MAX_COMBOS 32
+#endif
+#ifndef SOKOL_INPUT_MAX_COMBO_STEPS
+#define SOKOL_INPUT_MAX_COMBO_STEPS 8
+#endif
+// Distinct keys/buttons across all combos, the width of the transition table
+#ifndef SOKOL_INPUT_MAX_COMBO_SYMBOLS
+#define SOKOL_INPUT_MAX_COMBO_SYMBOLS 32
+#endif
+#ifndef SOKOL_INPUT_COMBO_TIMEOUT
+#define SOKOL_INPUT_COMBO_TIMEOUT .25f
+#endif
+
+#if SOKOL_INPUT_MAX_COMBO_SYMBOLS > 255
+#error SOKOL_INPUT_MAX_COMBO_SYMBOLS must be at most 255
+#endif
+
+#ifndef SOKOL_INPUT_MALLOC
+#define SOKOL_INPUT_MALLOC(S) malloc(S)
+#endif
+#ifndef SOKOL_INPUT_FREE
+#define SOKOL_INPUT_FREE(P) free(P)
+#endif
+
+#if !defined(SOKOL_INPUT_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define _INPUT_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define _INPUT_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define _INPUT_NEON
+#endif
+#endif
+
+#define _MAX(A, B)    ((A) > (B) ? (A) : (B))
+#define _MIN(A, B)    ((A) < (B) ? (A) : (B))
+#define _CLAMP(V, LO, HI) _MIN(_MAX(V, LO), HI)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define _INPUT_LOAD_ACQUIRE(P)     ((uint32_t)InterlockedCompareExchange((volatile LONG*)(P), 0, 0))
+#define _INPUT_STORE_RELEASE(P, V) InterlockedExchange((volatile LONG*)(P), (LONG)(V))
+#define _INPUT_LOAD_RELAXED(P)     (*(volatile uint32_t*)(P))
+#define _INPUT_STORE_RELAXED(P, V) (*(volatile uint32_t*)(P) = (V))
+#define _INPUT_FENCE_ACQUIRE()     MemoryBarrier()
+#define _INPUT_FENCE_RELEASE()     MemoryBarrier()
+#else
+#define _INPUT_LOAD_ACQUIRE(P)     __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define _INPUT_STORE_RELEASE(P, V) __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+#define _INPUT_LOAD_RELAXED(P)     __atomic_load_n((P), __ATOMIC_RELAXED)
+#define _INPUT_STORE_RELAXED(P, V) __atomic_store_n((P), (V), __ATOMIC_RELAXED)
+#define _INPUT_FENCE_ACQUIRE()     __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define _INPUT_FENCE_RELEASE()     __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+// Key state is kept as a 512-bit set (SAPP_MAX_KEYCODES), 8 words = one cache line
+#define _INPUT_MAX_KEYS  512
+#define _INPUT_KEY_WORDS (_INPUT_MAX_KEYS / 64)
+#define _INPUT_MAX_BUTTONS 3
+// SAPP_MAX_TOUCHPOINTS, the id table keeps at least half of its buckets empty so probes stay short
+#define _INPUT_MAX_TOUCHES     8
+#define _INPUT_TOUCH_TABLE_LOG 4
+#define _INPUT_TOUCH_TABLE     (1 << _INPUT_TOUCH_TABLE_LOG)
+
+typedef struct {
+    uint64_t w[_INPUT_KEY_WORDS];
+} _input_bits;
+
+static inline bool _input_bits_test(const _input_bits *bits, int i) {
+    return (unsigned)i < _INPUT_MAX_KEYS && ((bits->w[i >> 6] >> (i & 63)) & 1);
+}
+
+// Masked compares over a whole 512-bit set: (bits & mask) == mask, and (bits & mask) != 0
+static inline bool _input_bits_contains(const uint64_t *bits, const uint64_t *mask) {
+#if defined(_INPUT_AVX2)
+    __m256i m0 = _mm256_loadu_si256((const __m256i*)mask);
+    __m256i m1 = _mm256_loadu_si256((const __m256i*)(mask + 4));
+    __m256i b0 = _mm256_loadu_si256((const __m256i*)bits);
+    __m256i b1 = _mm256_loadu_si256((const __m256i*)(bits + 4));
+    __m256i missing = _mm256_or_si256(_mm256_andnot_si256(b0, m0), _mm256_andnot_si256(b1, m1));
+    return _mm256_testz_si256(missing, missing);
+#elif defined(_INPUT_SSE2)
+    __m128i missing = _mm_setzero_si128();
+    for (int i = 0; i < _INPUT_KEY_WORDS; i += 2)
+        missing = _mm_or_si128(missing, _mm_andnot_si128(_mm_loadu_si128((const __m128i*)(bits + i)),
+                                                         _mm_loadu_si128((const __m128i*)(mask + i))));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(missing, _mm_setzero_si128())) == 0xFFFF;
+#elif defined(_INPUT_NEON)
+    uint64x2_t missing = vdupq_n_u64(0);
+    for (int i = 0; i < _INPUT_KEY_WORDS; i += 2)
+        missing = vorrq_u64(missing, vbicq_u64(vld1q_u64(mask + i), vld1q_u64(bits + i)));
+    return !(vgetq_lane_u64(missing, 0) | vgetq_lane_u64(missing, 1));
+#else
+    uint64_t missing = 0;
+    for (int i = 0; i < _INPUT_KEY_WORDS; i++)
+        missing |= mask[i] & ~bits[i];
+    return !missing;
+#endif
+}
+
+static inline bool _input_bits_intersects(const uint64_t *bits, const uint64_t *mask) {
+#if defined(_INPUT_AVX2)
+    __m256i any = _mm256_or_si256(_mm256_and_si256(_mm256_loadu_si256((const __m256i*)bits), _mm256_loadu_si256((const __m256i*)mask)),
+                                  _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(bits + 4)), _mm256_loadu_si256((const __m256i*)(mask + 4))));
+    return !_mm256_testz_si256(any, any);
+#elif defined(_INPUT_SSE2)
+    __m128i any = _mm_setzero_si128();
+    for (int i = 0; i < _INPUT_KEY_WORDS; i += 2)
+        any = _mm_or_si128(any, _mm_and_si128(_mm_loadu_si128((const __m128i*)(bits + i)),
+                                              _mm_loadu_si128((const __m128i*)(mask + i))));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) != 0xFFFF;
+#elif defined(_INPUT_NEON)
+    uint64x2_t any = vdupq_n_u64(0);
+    for (int i = 0; i < _INPUT_KEY_WORDS; i += 2)
+        any = vorrq_u64(any, vandq_u64(vld1q_u64(bits + i), vld1q_u64(mask + i)));
+    return (vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1)) != 0;
+#else
+    uint64_t any = 0;
+    for (int i = 0; i < _INPUT_KEY_WORDS; i++)
+        any |= bits[i] & mask[i];
+    return any != 0;
+#endif
+}
+
+static inline void _input_bits_assign(_input_bits *bits, int i, bool value) {
+    uint64_t mask = 1ull << (i & 63);
+    if (value)
+        bits->w[i >> 6] |= mask;
+    else
+        bits->w[i >> 6] &= ~mask;
+}
+
+static inline int _input_ctz64(uint64_t x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (int)i;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int i = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+// Recording stream: "SIR" + version, then one tag byte per entry.
+// Tag: event type in the low 5 bits, _INPUT_REC_* flags above it, or _INPUT_REC_FLUSH
+// followed by the time delta of the flush
+#define _INPUT_REC_VERSION   4
+#define _INPUT_REC_REPEAT    0x20
+#define _INPUT_REC_MODIFIERS 0x40
+#define _INPUT_REC_FLUSH     0x80
+#define _INPUT_REC_MAX_ENTRY 48
+#define _INPUT_REC_TYPE_MASK 0x1F
+
+// C99 compile-time check, the array size goes negative when cond is false
+#define _INPUT_STATIC_ASSERT(cond, name) typedef char _input_static_assert_##name[(cond) ? 1 : -1]
+// The gamepad record types continue after the sokol_app event types and must fit the tag's type bits
+_INPUT_STATIC_ASSERT((int)_SAPP_EVENTTYPE_NUM <= (int)SAPP_INPUT_RECORD_GAMEPAD_CONNECTED, gamepad_records_after_sapp_events);
+_INPUT_STATIC_ASSERT(SAPP_INPUT_RECORD_GAMEPAD_AXIS <= _INPUT_REC_TYPE_MASK, record_types_fit_tag);
+
+#define _INPUT_ACTION_WORDS ((SOKOL_INPUT_MAX_ACTIONS + 63) / 64)
+#define _INPUT_ACTION_NAME  32
+
+enum {
+    _INPUT_BIND_KEY,
+    _INPUT_BIND_BUTTON
+};
+
+// Flat binding table, unbinding swaps the last entry into the hole
+typedef struct {
+    int count;
+    uint16_t action[SOKOL_INPUT_MAX_BINDINGS];
+    uint16_t code[SOKOL_INPUT_MAX_BINDINGS];
+    uint8_t kind[SOKOL_INPUT_MAX_BINDINGS];
+    uint32_t modifiers[SOKOL_INPUT_MAX_BINDINGS];
+} _input_bindings;
+
+typedef struct {
+    int count;
+    char names[SOKOL_INPUT_MAX_ACTIONS][_INPUT_ACTION_NAME];
+    _input_bindings bindings;
+    // Evaluated lazily after the key/button/modifier state changed, `prev` is latched at flush
+    bool dirty;
+    uint64_t down[_INPUT_ACTION_WORDS];
+    uint64_t prev[_INPUT_ACTION_WORDS];
+    uint64_t pressed[_INPUT_ACTION_WORDS];
+    uint64_t released[_INPUT_ACTION_WORDS];
+} _input_actions;
+
+// Virtual axes, `ramp` is the smoothed key value and only moves at flush. `value` is what queries see after the
+// current key state and the gamepad are applied, evaluated lazily once actions or gamepad axes changed.
+typedef struct {
+    int count;
+    bool dirty;
+    sapp_virtual_axis_desc desc[SOKOL_INPUT_MAX_VIRTUAL_AXES];
+    float ramp[SOKOL_INPUT_MAX_VIRTUAL_AXES];
+    float value[SOKOL_INPUT_MAX_VIRTUAL_AXES];
+} _input_virtual_axes;
+
+// Input time only moves forward: with each applied event and with each flush.
+// Press times are written on transitions only, hold queries compare them against `time`.
+// They are kept as microsecond ticks that wrap after about 71 minutes, holds are measured by unsigned differences.
+typedef struct {
+    double time;
+    double prev_time;
+    uint32_t keys[_INPUT_MAX_KEYS];
+    uint32_t buttons[_INPUT_MAX_BUTTONS];
+} _input_holds;
+
+static inline uint32_t _input_ticks(double seconds) {
+    return (uint32_t)(uint64_t)(seconds * 1e6 + .5);
+}
+
+#define _INPUT_COMBO_WORDS    ((SOKOL_INPUT_MAX_COMBOS + 63) / 64)
+#define _INPUT_COMBO_ALPHABET (_INPUT_MAX_KEYS + _INPUT_MAX_BUTTONS)
+#define _INPUT_COMBO_NODES    (SOKOL_INPUT_MAX_COMBOS * SOKOL_INPUT_MAX_COMBO_STEPS + 1)
+
+// Matching state, saved in replay keyframes
+typedef struct {
+    uint16_t node;
+    uint8_t head;
+    // Times of the last presses that fed the automaton, the ring slot `head` is the oldest
+    double times[SOKOL_INPUT_MAX_COMBO_STEPS];
+} _input_combo_run;
+
+typedef struct {
+    int count;
+    uint8_t length[SOKOL_INPUT_MAX_COMBOS];
+    uint16_t steps[SOKOL_INPUT_MAX_COMBOS][SOKOL_INPUT_MAX_COMBO_STEPS];
+    float timeouts[SOKOL_INPUT_MAX_COMBOS][SOKOL_INPUT_MAX_COMBO_STEPS];
+    // Key/button -> symbol + 1, 0 for presses that are not part of any combo
+    int symbols;
+    uint8_t symbol[_INPUT_COMBO_ALPHABET];
+    // Compiled lazily: goto and failure functions folded into one complete transition table.
+    // `match` heads the list of combos ending at a node, chained through `next_match`,
+    // `output` links to the nearest proper suffix node that ends a combo.
+    bool dirty;
+    uint16_t next[_INPUT_COMBO_NODES][SOKOL_INPUT_MAX_COMBO_SYMBOLS];
+    int16_t match[_INPUT_COMBO_NODES];
+    int16_t next_match[SOKOL_INPUT_MAX_COMBOS];
+    uint16_t output[_INPUT_COMBO_NODES];
+    _input_combo_run run;
+    uint64_t triggered[_INPUT_COMBO_WORDS];
+} _input_combos;
+
+typedef struct {
+    double time;
+    float x, y;
+} _input_motion_sample;
+
+// Structure of arrays indexed by slot, the masks are the phase bits of every slot.
+// `table` maps ids to slot + 1 with linear probing, 0 marks an empty bucket.
+typedef struct {
+    uint32_t id[_INPUT_MAX_TOUCHES];
+    float x[_INPUT_MAX_TOUCHES], y[_INPUT_MAX_TOUCHES];
+    float start_x[_INPUT_MAX_TOUCHES], start_y[_INPUT_MAX_TOUCHES];
+    double start_time[_INPUT_MAX_TOUCHES];
+    uint8_t down, began, moved, ended, cancelled;
+    uint8_t table[_INPUT_TOUCH_TABLE];
+} _input_touches;
+
+enum {
+    _INPUT_GESTURE_IDLE,
+    // One pointer down and still within the tap slop
+    _INPUT_GESTURE_POSSIBLE,
+    _INPUT_GESTURE_LONG_PRESS,
+    _INPUT_GESTURE_PAN,
+    _INPUT_GESTURE_TRANSFORM,
+    // Nothing more to recognize until every pointer is up
+    _INPUT_GESTURE_WAIT
+};
+
+// Pointers are touch slots, the left mouse button is pointer _INPUT_MAX_TOUCHES
+#define _INPUT_GESTURE_MOUSE _INPUT_MAX_TOUCHES
+
+// Recognizer state, saved in replay keyframes
+typedef struct {
+    int state;
+    int count;
+    int id[2];
+    float x[2], y[2];
+    float start_x, start_y;
+    double start_time;
+    float dist0, angle0;
+    bool pinching, rotating;
+    double tap_time;
+    float tap_x, tap_y;
+} _input_gesture_run;
+
+typedef struct {
+    sapp_gesture_config config;
+    _input_gesture_run run;
+    int count;
+    sapp_gesture queue[SOKOL_INPUT_GESTURE_QUEUE];
+} _input_gestures;
+
+// Samples persist across frames, `count` grows up to the ring size, `head` is the next slot
+typedef struct {
+    int count, head;
+    _input_motion_sample samples[SOKOL_INPUT_MOTION_HISTORY];
+    struct {
+        double time;
+        float x, y, vx, vy, ax, ay;
+    } filter;
+} _input_motion;
+
+#define _INPUT_HISTORY_KEYS 64
+
+// Frames [start, frame) that are still in the ring are valid, ring[frame % size] = {keys, bits}
+typedef struct {
+    int key_count;
+    uint16_t keys[_INPUT_HISTORY_KEYS];
+    uint64_t start;
+    uint64_t ring[SOKOL_INPUT_HISTORY_FRAMES][2];
+} _input_history;
+
+typedef struct {
+    sapp_input_write_func write;
+    void *user_data;
+    uint64_t time;
+    int32_t x, y;
+    uint32_t modifiers;
+    size_t length;
+    uint8_t buffer[1024];
+} _input_recorder;
+
+// Gamepad mapping targets are buttons, or axes with _INPUT_MAPPING_AXIS set
+#define _INPUT_MAPPING_AXIS   0x80
+// Axis source flags: invert the range (~), read only its upper (+) or lower (-) half
+#define _INPUT_MAPPING_INVERT 0x01
+#define _INPUT_MAPPING_HIGH   0x02
+#define _INPUT_MAPPING_LOW    0x04
+
+typedef struct {
+    uint8_t target;
+    // Axis targets named with a +/- prefix drive only that half of the axis
+    int8_t half;
+    // 'b', 'a' or 'h' and its number in the device's own enumeration
+    uint8_t source, index;
+    // Hat direction mask for hats, _INPUT_MAPPING_* flags for axes
+    uint8_t detail;
+} _input_mapping_binding;
+
+typedef struct {
+    uint8_t guid[16];
+    bool used;
+    uint8_t count;
+    uint32_t first;
+} _input_mapping;
+
+// Open addressed on the GUID and kept at most half full, bindings of every mapping in one array
+typedef struct {
+    int count, capacity;
+    _input_mapping *slots;
+    uint32_t binding_count, binding_capacity;
+    _input_mapping_binding *bindings;
+} _input_mappings;
+
+// A sapp_gamepad_response reduced to what the axis pass needs
+typedef struct {
+    int deadzone_mode, curve;
+    float deadzone, scale, anti_deadzone, gain;
+    float base, steps[SAPP_GAMEPAD_CURVE_POINTS - 1];
+} _input_response;
+
+// Processed axes, recomputed for every pad at once when `dirty`
+typedef struct {
+    sapp_gamepad_response config[SAPP_GAMEPAD_RESPONSE_COUNT];
+    _input_response prepared[SAPP_GAMEPAD_RESPONSE_COUNT];
+    bool dirty;
+    float values[SAPP_GAMEPAD_AXIS_COUNT][_INPUT_GAMEPAD_LANES];
+} _input_gamepad_axes;
+
+// Cursor coordinates: floats, or fixed point in 1/SOKOL_INPUT_RECORD_SUBPIXEL steps for lockstep games
+#if defined(SOKOL_INPUT_FIXED_CURSOR)
+typedef int32_t _input_coord;
+#define _INPUT_COORD(V)      _input_quantize(V)
+#define _INPUT_COORD_FLOAT(V) ((float)(V) / (float)SOKOL_INPUT_RECORD_SUBPIXEL)
+#else
+typedef float _input_coord;
+#define _INPUT_COORD(V)       (V)
+#define _INPUT_COORD_FLOAT(V) (V)
+#endif
+// Truncated like the int cursor always was
+#define _INPUT_COORD_INT(V) ((int)_INPUT_COORD_FLOAT(V))
+
+typedef struct {
+    _input_bits keys;
+    uint8_t buttons;
+    int modifier;
+    struct {
+        _input_coord x, y;
+    } cursor;
+    // Summed mouse_dx/dy of the frame, the only motion reported while the mouse is locked
+    struct {
+        float x, y;
+    } motion;
+    struct {
+        float x, y;
+    } scroll;
+    // Bit p of `gamepads` is set while gamepad p is connected, axes are stored axis-major
+    uint8_t gamepads;
+    uint32_t gamepad_buttons[SOKOL_INPUT_MAX_GAMEPADS];
+    float gamepad_axes[SAPP_GAMEPAD_AXIS_COUNT][_INPUT_GAMEPAD_LANES];
+} _state;
+
+struct sapp_input_context {
+    // Double buffered, flush flips `current` instead of copying the whole state
+    _state states[2];
+    int current;
+    // Key words touched since the last flush, the only ones that need reconciling
+    uint8_t dirty;
+    // Transitions are latched as events arrive so sub-frame taps survive until the next flush
+    _input_bits pressed, released;
+    uint8_t buttons_pressed, buttons_released;
+    uint8_t press_count[_INPUT_MAX_KEYS];
+    uint8_t button_press_count[_INPUT_MAX_BUTTONS];
+    uint32_t gamepad_pressed[SOKOL_INPUT_MAX_GAMEPADS], gamepad_released[SOKOL_INPUT_MAX_GAMEPADS];
+    sapp_gamepad_backend gamepad_backend;
+    _input_mappings mappings;
+    _input_gamepad_axes gamepad_axes;
+    int scroll_count;
+#if SOKOL_INPUT_SCROLL_HISTORY > 0
+    struct {
+        float x, y;
+    } scroll_history[SOKOL_INPUT_SCROLL_HISTORY];
+#endif
+    double start_time;
+    _input_recorder recorder;
+    _input_actions actions;
+    _input_virtual_axes virtual_axes;
+    _input_holds holds;
+    _input_combos combos;
+    _input_history history;
+    _input_motion motion;
+    _input_touches touches;
+    _input_gestures gestures;
+    // Set by replay so the next flush uses the recorded flush time instead of the clock
+    bool has_flush_time;
+    double flush_time;
+    // Time of the previous flush, virtual axes ramp by the time between flushes
+    double last_flush_time;
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    // Positions count up from 0 each frame, the ring index is pos % size
+    uint32_t queue_head;
+    sapp_input_record queue[SOKOL_INPUT_EVENT_QUEUE_SIZE];
+#endif
+    bool threaded;
+    uint64_t frame;
+    // SPSC handoff: head and the drop count are only written by the producer, tail only by the consumer.
+    // A full cache line of padding before each group keeps it off the lines the other side writes,
+    // whatever the alignment of the context.
+    uint8_t _pad0[64];
+    uint32_t pump_head;
+    uint32_t pump_dropped;
+    uint8_t _pad1[64];
+    uint32_t pump_tail;
+    uint8_t _pad2[64];
+    sapp_input_record pump[SOKOL_INPUT_PUMP_QUEUE_SIZE];
+    // Seqlock published snapshot of the last flushed frame, odd sequence = write in progress
+    uint8_t _pad3[64];
+    uint32_t snapshot_seq;
+    uint32_t snapshot[sizeof(sapp_input_state) / 4];
+};
+
+// The global API operates on this context directly, so it costs no pointer load
+static sapp_input_context _input_state;
+
+#define _INPUT_CURRENT(CTX) ((CTX)->states[(CTX)->current])
+#define _INPUT_PREV(CTX)    ((CTX)->states[(CTX)->current ^ 1])
+
+static double _input_now(void) {
+#if defined(_WIN32)
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER counter;
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#elif defined(__APPLE__)
+    static mach_timebase_info_data_t timebase;
+    if (!timebase.denom)
+        mach_timebase_info(&timebase);
+    return (double)(mach_absolute_time() * timebase.numer / timebase.denom) / 1e9;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#else
+    // Strict ISO mode hides clock_gettime, the wall clock is the portable fallback
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+#endif
+}
+
+// Seconds since init in whole microseconds, the resolution recordings keep, so replayed times are the same doubles
+static double _input_elapsed(const sapp_input_context *ctx) {
+    double seconds = _input_now() - ctx->start_time;
+    return seconds > 0 ? (double)(uint64_t)(seconds * 1e6 + .5) / 1e6 : 0.;
+}
+
+static inline void _input_count(uint8_t *count) {
+    if (*count < UINT8_MAX)
+        (*count)++;
+}
+
+static void _input_compile_combos(_input_combos *c) {
+    uint16_t fail[_INPUT_COMBO_NODES], queue[_INPUT_COMBO_NODES];
+    int nodes = 1, head = 0, tail = 0;
+    memset(c->next, 0, sizeof(c->next));
+    memset(c->match, -1, sizeof(c->match));
+    memset(c->output, 0, sizeof(c->output));
+    // Trie: the root is never a child, so 0 doubles as "no edge" until the rows get folded
+    for (int i = 0; i < c->count; i++) {
+        int node = 0;
+        for (int j = 0; j < c->length[i]; j++) {
+            uint16_t *edge = &c->next[node][c->symbol[c->steps[i][j]] - 1];
+            if (!*edge)
+                *edge = (uint16_t)nodes++;
+            node = *edge;
+        }
+        c->next_match[i] = c->match[node];
+        c->match[node] = (int16_t)i;
+    }
+    // Breadth first, so the failure target's row is always complete before it is read
+    fail[0] = 0;
+    queue[tail++] = 0;
+    while (head < tail) {
+        int u = queue[head++];
+        for (int s = 0; s < c->symbols; s++) {
+            uint16_t v = c->next[u][s];
+            uint16_t f = u ? c->next[fail[u]][s] : 0;
+            if (v) {
+                fail[v] = f;
+                c->output[v] = c->match[f] >= 0 ? f : c->output[f];
+                queue[tail++] = v;
+            } else
+                c->next[u][s] = f;
+        }
+    }
+    c->dirty = false;
+}
+
+static bool _input_combo_in_time(const _input_combos *c, int combo) {
+    const _input_combo_run *run = &c->run;
+    int n = c->length[combo];
+    int first = (run->head + SOKOL_INPUT_MAX_COMBO_STEPS - n) % SOKOL_INPUT_MAX_COMBO_STEPS;
+    for (int i = 1; i < n; i++) {
+        float timeout = c->timeouts[combo][i];
+        double t0 = run->times[(first + i - 1) % SOKOL_INPUT_MAX_COMBO_STEPS];
+        double t1 = run->times[(first + i) % SOKOL_INPUT_MAX_COMBO_STEPS];
+        if (timeout > 0 && t1 - t0 > timeout)
+            return false;
+    }
+    return true;
+}
+
+static void _input_combo_press(sapp_input_context *ctx, int code) {
+    _input_combos *c = &ctx->combos;
+    if (!c->count)
+        return;
+    int symbol = c->symbol[code];
+    if (!symbol) {
+        c->run.node = 0;
+        return;
+    }
+    if (c->dirty)
+        _input_compile_combos(c);
+    c->run.times[c->run.head] = ctx->holds.time;
+    c->run.head = (uint8_t)((c->run.head + 1) % SOKOL_INPUT_MAX_COMBO_STEPS);
+    c->run.node = c->next[c->run.node][symbol - 1];
+    // Only nodes that end a combo are visited, timing is checked for the matched suffix alone
+    for (int node = c->run.node; node; node = c->output[node])
+        for (int i = c->match[node]; i >= 0; i = c->next_match[i])
+            if (_input_combo_in_time(c, i))
+                c->triggered[i >> 6] |= 1ull << (i & 63);
+}
+
+static void _input_key(sapp_input_context *ctx, int key, bool down) {
+    bool was_down = _input_bits_test(&_INPUT_CURRENT(ctx).keys, key);
+    if (down == was_down)
+        return;
+    _input_bits_assign(&_INPUT_CURRENT(ctx).keys, key, down);
+    ctx->dirty |= (uint8_t)(1u << (key >> 6));
+    ctx->actions.dirty = true;
+    if (down) {
+        _input_bits_assign(&ctx->pressed, key, true);
+        _input_count(&ctx->press_count[key]);
+        ctx->holds.keys[key] = _input_ticks(ctx->holds.time);
+        _input_combo_press(ctx, key);
+    } else
+        _input_bits_assign(&ctx->released, key, true);
+}
+
+static void _input_modifiers(sapp_input_context *ctx, uint32_t modifiers) {
+    if (_INPUT_CURRENT(ctx).modifier != (int)modifiers) {
+        _INPUT_CURRENT(ctx).modifier = (int)modifiers;
+        ctx->actions.dirty = true;
+    }
+}
+
+static void _input_button(sapp_input_context *ctx, int button, bool down) {
+    uint8_t mask = (uint8_t)(1u << button);
+    if (down == !!(_INPUT_CURRENT(ctx).buttons & mask))
+        return;
+    ctx->actions.dirty = true;
+    if (down) {
+        _INPUT_CURRENT(ctx).buttons |= mask;
+        ctx->buttons_pressed |= mask;
+        _input_count(&ctx->button_press_count[button]);
+        ctx->holds.buttons[button] = _input_ticks(ctx->holds.time);
+        _input_combo_press(ctx, _INPUT_MAX_KEYS + button);
+    } else {
+        _INPUT_CURRENT(ctx).buttons &= (uint8_t)~mask;
+        ctx->buttons_released |= mask;
+    }
+}
+
+void sapp_ctx_input_init(sapp_input_context *ctx) {
+    // Release what a previous init acquired, a new context arrives zeroed
+    sapp_ctx_input_stop_recording(ctx);
+    sapp_ctx_input_set_gamepad_backend(ctx, NULL);
+    sapp_ctx_input_clear_gamepad_mappings(ctx);
+    memset(ctx, 0, sizeof(sapp_input_context));
+    ctx->start_time = _input_now();
+    sapp_gesture_config *gc = &ctx->gestures.config;
+    gc->tap_time = .3f;
+    gc->tap_slop = 10.f;
+    gc->double_tap_time = .3f;
+    gc->double_tap_slop = 30.f;
+    gc->long_press_time = .5f;
+    gc->swipe_time = .3f;
+    gc->swipe_distance = 50.f;
+    gc->pinch_threshold = .05f;
+    gc->rotate_threshold = .1f;
+    for (int group = 0; group < SAPP_GAMEPAD_RESPONSE_COUNT; group++) {
+        sapp_gamepad_response response;
+        memset(&response, 0, sizeof(sapp_gamepad_response));
+        response.deadzone = group == SAPP_GAMEPAD_RESPONSE_TRIGGERS ? .05f : .15f;
+        response.saturation = 1.f;
+        for (int i = 0; i < SAPP_GAMEPAD_CURVE_POINTS; i++)
+            response.points[i] = (float)i / (float)(SAPP_GAMEPAD_CURVE_POINTS - 1);
+        sapp_ctx_input_set_gamepad_response(ctx, group, &response);
+    }
+}
+
+static inline bool _input_is_touch(int type) {
+    return type >= SAPP_EVENTTYPE_TOUCHES_BEGAN && type <= SAPP_EVENTTYPE_TOUCHES_CANCELLED;
+}
+
+static inline bool _input_is_gamepad(int type) {
+    return type >= SAPP_INPUT_RECORD_GAMEPAD_CONNECTED && type <= SAPP_INPUT_RECORD_GAMEPAD_AXIS;
+}
+
+static inline uint32_t _input_touch_id(uintptr_t identifier) {
+    uint64_t v = (uint64_t)identifier;
+    return (uint32_t)(v ^ (v >> 32));
+}
+
+// Writes one record, or one per changed touch point for touch events. Returns the number of records.
+static int _input_translate(sapp_input_context *ctx, const sapp_event *e, sapp_input_record *r) {
+    memset(r, 0, sizeof(sapp_input_record));
+    r->time = _input_elapsed(ctx);
+    r->type = (uint8_t)e->type;
+    r->modifiers = e->modifiers;
+    if (_input_is_touch(e->type)) {
+        int n = 0, count = e->num_touches < _INPUT_MAX_TOUCHES ? e->num_touches : _INPUT_MAX_TOUCHES;
+        for (int i = 0; i < count; i++) {
+            const sapp_touchpoint *tp = &e->touches[i];
+            if (!tp->changed)
+                continue;
+            r[n] = r[0];
+            r[n].modifiers = _input_touch_id(tp->identifier);
+            r[n].x = tp->pos_x;
+            r[n].y = tp->pos_y;
+            n++;
+        }
+        return n;
+    }
+    switch (e->type) {
+        case SAPP_EVENTTYPE_KEY_UP:
+        case SAPP_EVENTTYPE_KEY_DOWN:
+            r->code = (uint16_t)e->key_code;
+            r->flags = e->key_repeat ? SAPP_INPUT_RECORD_REPEAT : 0;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_UP:
+        case SAPP_EVENTTYPE_MOUSE_DOWN:
+        case SAPP_EVENTTYPE_MOUSE_MOVE:
+            r->code = (uint16_t)e->mouse_button;
+            r->x = e->mouse_x;
+            r->y = e->mouse_y;
+            r->dx = e->mouse_dx;
+            r->dy = e->mouse_dy;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_SCROLL:
+            r->x = e->scroll_x;
+            r->y = e->scroll_y;
+            break;
+        default:
+            break;
+    }
+    return 1;
+}
+
+static uint8_t* _input_put_varint(uint8_t *p, uint64_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static bool _input_get_varint(sapp_input_replay *rp, uint64_t *v) {
+    *v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (rp->pos >= rp->size)
+            return false;
+        uint8_t b = rp->data[rp->pos++];
+        *v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
+
+static inline uint64_t _input_zigzag(int32_t v) {
+    return (uint64_t)(((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+static inline int32_t _input_unzigzag(uint64_t v) {
+    return (int32_t)((uint32_t)(v >> 1) ^ (0u - (uint32_t)(v & 1)));
+}
+
+// Truncates toward zero like _INPUT_COORD_INT, so a replayed position lands on the same integer pixel as the live one
+static inline int32_t _input_quantize(float v) {
+    return (int32_t)(v * (float)SOKOL_INPUT_RECORD_SUBPIXEL);
+}
+
+static void _input_rec_write(_input_recorder *rec, const uint8_t *data, size_t size) {
+    if (rec->length + size > sizeof(rec->buffer)) {
+        rec->write(rec->buffer, rec->length, rec->user_data);
+        rec->length = 0;
+    }
+    memcpy(rec->buffer + rec->length, data, size);
+    rec->length += size;
+}
+
+static uint8_t* _input_rec_position(_input_recorder *rec, uint8_t *p, float x, float y) {
+    int32_t qx = _input_quantize(x), qy = _input_quantize(y);
+    p = _input_put_varint(p, _input_zigzag(qx - rec->x));
+    p = _input_put_varint(p, _input_zigzag(qy - rec->y));
+    rec->x = qx;
+    rec->y = qy;
+    return p;
+}
+
+static uint8_t* _input_rec_time(_input_recorder *rec, uint8_t *p, double seconds) {
+    uint64_t time = seconds > 0 ? (uint64_t)(seconds * 1e6 + .5) : 0;
+    p = _input_put_varint(p, time > rec->time ? time - rec->time : 0);
+    rec->time = _MAX(time, rec->time);
+    return p;
+}
+
+static void _input_rec_flush(_input_recorder *rec, double time) {
+    uint8_t entry[_INPUT_REC_MAX_ENTRY];
+    entry[0] = _INPUT_REC_FLUSH;
+    uint8_t *p = _input_rec_time(rec, entry + 1, time);
+    _input_rec_write(rec, entry, (size_t)(p - entry));
+}
+
+static void _input_rec_event(_input_recorder *rec, const sapp_input_record *r) {
+    uint8_t entry[_INPUT_REC_MAX_ENTRY], *p = entry + 1;
+    entry[0] = (uint8_t)(r->type & _INPUT_REC_TYPE_MASK);
+    if (r->flags & SAPP_INPUT_RECORD_REPEAT)
+        entry[0] |= _INPUT_REC_REPEAT;
+    p = _input_rec_time(rec, p, r->time);
+    // Touch records carry the touch id in place of the modifiers, gamepad records have none
+    if (!_input_is_touch(r->type) && !_input_is_gamepad(r->type) && r->modifiers != rec->modifiers) {
+        entry[0] |= _INPUT_REC_MODIFIERS;
+        p = _input_put_varint(p, r->modifiers);
+        rec->modifiers = r->modifiers;
+    }
+    switch (r->type) {
+        case SAPP_EVENTTYPE_KEY_UP:
+        case SAPP_EVENTTYPE_KEY_DOWN:
+            p = _input_put_varint(p, r->code);
+            break;
+        case SAPP_EVENTTYPE_MOUSE_UP:
+        case SAPP_EVENTTYPE_MOUSE_DOWN:
+            p = _input_put_varint(p, r->code);
+            p = _input_rec_position(rec, p, r->x, r->y);
+            break;
+        case SAPP_EVENTTYPE_MOUSE_MOVE:
+            p = _input_rec_position(rec, p, r->x, r->y);
+            p = _input_put_varint(p, _input_zigzag(_input_quantize(r->dx)));
+            p = _input_put_varint(p, _input_zigzag(_input_quantize(r->dy)));
+            break;
+        case SAPP_EVENTTYPE_MOUSE_SCROLL:
+            memcpy(p, &r->x, 4);
+            memcpy(p + 4, &r->y, 4);
+            p += 8;
+            break;
+        case SAPP_EVENTTYPE_TOUCHES_BEGAN:
+        case SAPP_EVENTTYPE_TOUCHES_MOVED:
+        case SAPP_EVENTTYPE_TOUCHES_ENDED:
+        case SAPP_EVENTTYPE_TOUCHES_CANCELLED:
+            p = _input_put_varint(p, r->modifiers);
+            p = _input_rec_position(rec, p, r->x, r->y);
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_CONNECTED:
+        case SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED:
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN:
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP:
+            p = _input_put_varint(p, r->code);
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_AXIS:
+            p = _input_put_varint(p, r->code);
+            memcpy(p, &r->x, 4);
+            p += 4;
+            break;
+        default:
+            break;
+    }
+    _input_rec_write(rec, entry, (size_t)(p - entry));
+}
+
+static bool _input_replay_position(sapp_input_replay *rp, float *x, float *y) {
+    uint64_t dx, dy;
+    if (!_input_get_varint(rp, &dx) || !_input_get_varint(rp, &dy))
+        return false;
+    rp->x += _input_unzigzag(dx);
+    rp->y += _input_unzigzag(dy);
+    *x = (float)rp->x / (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+    *y = (float)rp->y / (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+    return true;
+}
+
+// Returns 1 for an event, 0 for a frame boundary (only r->time is set), -1 at the end of the data or on error
+static int _input_replay_next(sapp_input_replay *rp, sapp_input_record *r) {
+    uint64_t v, dx, dy;
+    if (rp->failed || rp->pos >= rp->size)
+        return -1;
+    uint8_t tag = rp->data[rp->pos++];
+    memset(r, 0, sizeof(sapp_input_record));
+    if (!_input_get_varint(rp, &v))
+        goto FAIL;
+    rp->time += v;
+    r->time = (double)rp->time / 1e6;
+    if (tag == _INPUT_REC_FLUSH)
+        return 0;
+    r->type = tag & _INPUT_REC_TYPE_MASK;
+    r->flags = (tag & _INPUT_REC_REPEAT) ? SAPP_INPUT_RECORD_REPEAT : 0;
+    if (tag & _INPUT_REC_MODIFIERS) {
+        if (!_input_get_varint(rp, &v))
+            goto FAIL;
+        rp->modifiers = (uint32_t)v;
+    }
+    r->modifiers = rp->modifiers;
+    switch (r->type) {
+        case SAPP_EVENTTYPE_KEY_UP:
+        case SAPP_EVENTTYPE_KEY_DOWN:
+            if (!_input_get_varint(rp, &v))
+                goto FAIL;
+            r->code = (uint16_t)v;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_UP:
+        case SAPP_EVENTTYPE_MOUSE_DOWN:
+            if (!_input_get_varint(rp, &v) || !_input_replay_position(rp, &r->x, &r->y))
+                goto FAIL;
+            r->code = (uint16_t)v;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_MOVE:
+            if (!_input_replay_position(rp, &r->x, &r->y) || !_input_get_varint(rp, &dx) || !_input_get_varint(rp, &dy))
+                goto FAIL;
+            r->dx = (float)_input_unzigzag(dx) / (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+            r->dy = (float)_input_unzigzag(dy) / (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_SCROLL:
+            if (rp->size - rp->pos < 8)
+                goto FAIL;
+            memcpy(&r->x, rp->data + rp->pos, 4);
+            memcpy(&r->y, rp->data + rp->pos + 4, 4);
+            rp->pos += 8;
+            break;
+        case SAPP_EVENTTYPE_TOUCHES_BEGAN:
+        case SAPP_EVENTTYPE_TOUCHES_MOVED:
+        case SAPP_EVENTTYPE_TOUCHES_ENDED:
+        case SAPP_EVENTTYPE_TOUCHES_CANCELLED:
+            if (!_input_get_varint(rp, &v) || !_input_replay_position(rp, &r->x, &r->y))
+                goto FAIL;
+            r->modifiers = (uint32_t)v;
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_CONNECTED:
+        case SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED:
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN:
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP:
+            if (!_input_get_varint(rp, &v))
+                goto FAIL;
+            r->code = (uint16_t)v;
+            r->modifiers = 0;
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_AXIS:
+            if (!_input_get_varint(rp, &v) || rp->size - rp->pos < 4)
+                goto FAIL;
+            r->code = (uint16_t)v;
+            r->modifiers = 0;
+            memcpy(&r->x, rp->data + rp->pos, 4);
+            rp->pos += 4;
+            break;
+        default:
+            break;
+    }
+    return 1;
+FAIL:
+    rp->failed = true;
+    return -1;
+}
+
+// Fading memory alpha-beta-gamma gains for a discount of theta = e^(-dt / window) per sample, so the filter
+// remembers about the same span of time whether the mouse reports at 125 Hz or 8 kHz
+typedef struct {
+    float alpha, beta, gamma;
+} _input_filter_gains;
+
+static inline _input_filter_gains _input_filter_gains_for(float dt) {
+    _input_filter_gains g;
+    float u = dt / SOKOL_INPUT_MOTION_WINDOW;
+    float theta = 1.f / (1.f + u + .5f * u * u);
+    float d = 1.f - theta;
+    g.alpha = 1.f - theta * theta * theta;
+    g.beta = 1.5f * d * d * (1.f + theta);
+    g.gamma = .5f * d * d * d;
+    return g;
+}
+
+static inline void _input_filter_axis(const _input_filter_gains *g, float z, float dt, float *x, float *v, float *a) {
+    float xp = *x + *v * dt + .5f * *a * dt * dt;
+    float residual = z - xp;
+    *x = xp + g->alpha * residual;
+    *v += *a * dt + g->beta * residual / dt;
+    *a += 2.f * g->gamma * residual / (dt * dt);
+}
+
+static void _input_motion_sample_add(_input_motion *m, double time, float x, float y) {
+    _input_motion_sample *s = &m->samples[m->head];
+    s->time = time;
+    s->x = x;
+    s->y = y;
+    m->head = (m->head + 1) & (SOKOL_INPUT_MOTION_HISTORY - 1);
+    if (m->count < SOKOL_INPUT_MOTION_HISTORY)
+        m->count++;
+    float dt = (float)(time - m->filter.time);
+    if (m->count == 1 || dt > SOKOL_INPUT_MOTION_TIMEOUT) {
+        // First sample or the cursor came to rest: restart from standstill
+        m->filter.x = x;
+        m->filter.y = y;
+        m->filter.vx = m->filter.vy = m->filter.ax = m->filter.ay = 0.f;
+    } else if (dt > 0.f) {
+        _input_filter_gains g = _input_filter_gains_for(dt);
+        _input_filter_axis(&g, x, dt, &m->filter.x, &m->filter.vx, &m->filter.ax);
+        _input_filter_axis(&g, y, dt, &m->filter.y, &m->filter.vy, &m->filter.ay);
+    } else {
+        // Same timestamp, nothing to derive a rate from
+        m->filter.x = x;
+        m->filter.y = y;
+    }
+    m->filter.time = time;
+}
+
+// Returns NULL when the queue is full
+static sapp_gesture* _input_gesture_emit(_input_gestures *g, int type, int phase, double time, float x, float y) {
+    sapp_gesture *out = NULL;
+    if (phase == SAPP_GESTURE_CHANGED) {
+        // Merge into the latest entry of the same gesture if it is a change too
+        for (int i = g->count - 1; i >= 0; i--)
+            if (g->queue[i].type == type) {
+                if (g->queue[i].phase == SAPP_GESTURE_CHANGED)
+                    out = &g->queue[i];
+                break;
+            }
+    }
+    if (!out) {
+        if (g->count >= SOKOL_INPUT_GESTURE_QUEUE - (phase == SAPP_GESTURE_ENDED ? 0 : _INPUT_GESTURE_END_RESERVE))
+            return NULL;
+        out = &g->queue[g->count++];
+        memset(out, 0, sizeof(sapp_gesture));
+        out->type = type;
+        out->phase = phase;
+        out->scale = 1.f;
+    }
+    out->time = time;
+    out->x = x;
+    out->y = y;
+    return out;
+}
+
+static void _input_gesture_tick(_input_gestures *g, double time) {
+    _input_gesture_run *s = &g->run;
+    if (s->state == _INPUT_GESTURE_POSSIBLE && time - s->start_time >= g->config.long_press_time) {
+        s->state = _INPUT_GESTURE_LONG_PRESS;
+        _input_gesture_emit(g, SAPP_GESTURE_LONG_PRESS, SAPP_GESTURE_ENDED, time, s->x[0], s->y[0]);
+    }
+}
+
+static void _input_gesture_end(_input_gestures *g, double time) {
+    _input_gesture_run *s = &g->run;
+    float cx = (s->x[0] + s->x[1]) * .5f, cy = (s->y[0] + s->y[1]) * .5f;
+    if (s->state == _INPUT_GESTURE_PAN)
+        _input_gesture_emit(g, SAPP_GESTURE_PAN, SAPP_GESTURE_ENDED, time, s->x[0], s->y[0]);
+    if (s->state == _INPUT_GESTURE_TRANSFORM) {
+        if (s->pinching)
+            _input_gesture_emit(g, SAPP_GESTURE_PINCH, SAPP_GESTURE_ENDED, time, cx, cy);
+        if (s->rotating)
+            _input_gesture_emit(g, SAPP_GESTURE_ROTATE, SAPP_GESTURE_ENDED, time, cx, cy);
+    }
+}
+
+static void _input_gesture_transform(_input_gestures *g, double time) {
+    _input_gesture_run *s = &g->run;
+    const sapp_gesture_config *c = &g->config;
+    float vx = s->x[1] - s->x[0], vy = s->y[1] - s->y[0];
+    float cx = (s->x[0] + s->x[1]) * .5f, cy = (s->y[0] + s->y[1]) * .5f;
+    float scale = s->dist0 > 0.f ? sqrtf(vx * vx + vy * vy) / s->dist0 : 1.f;
+    float rotation = atan2f(vy, vx) - s->angle0;
+    if (rotation > 3.14159265f)
+        rotation -= 6.28318531f;
+    else if (rotation < -3.14159265f)
+        rotation += 6.28318531f;
+    sapp_gesture *out;
+    if (s->pinching || fabsf(scale - 1.f) >= c->pinch_threshold) {
+        if ((out = _input_gesture_emit(g, SAPP_GESTURE_PINCH, s->pinching ? SAPP_GESTURE_CHANGED : SAPP_GESTURE_BEGAN, time, cx, cy)))
+            out->scale = scale;
+        s->pinching = true;
+    }
+    if (s->rotating || fabsf(rotation) >= c->rotate_threshold) {
+        if ((out = _input_gesture_emit(g, SAPP_GESTURE_ROTATE, s->rotating ? SAPP_GESTURE_CHANGED : SAPP_GESTURE_BEGAN, time, cx, cy)))
+            out->rotation = rotation;
+        s->rotating = true;
+    }
+}
+
+// down: 1 = pressed, 0 = moved, -1 = released, -2 = cancelled
+static void _input_gesture_pointer(_input_gestures *g, int id, int down, double time, float x, float y) {
+    _input_gesture_run *s = &g->run;
+    const sapp_gesture_config *c = &g->config;
+    int i = s->count > 0 && s->id[0] == id ? 0 : s->count > 1 && s->id[1] == id ? 1 : -1;
+    _input_gesture_tick(g, time);
+    if (down > 0) {
+        if (i >= 0 || s->count == 2)
+            return;
+        i = s->count++;
+        s->id[i] = id;
+        s->x[i] = x;
+        s->y[i] = y;
+        if (i == 0) {
+            s->state = _INPUT_GESTURE_POSSIBLE;
+            s->start_x = x;
+            s->start_y = y;
+            s->start_time = time;
+        } else if (s->state != _INPUT_GESTURE_WAIT) {
+            _input_gesture_end(g, time);
+            float vx = s->x[1] - s->x[0], vy = s->y[1] - s->y[0];
+            s->state = _INPUT_GESTURE_TRANSFORM;
+            s->dist0 = sqrtf(vx * vx + vy * vy);
+            s->angle0 = atan2f(vy, vx);
+            s->pinching = s->rotating = false;
+        }
+        return;
+    }
+    if (i < 0)
+        return;
+    sapp_gesture *out;
+    float dx = x - s->x[i], dy = y - s->y[i];
+    s->x[i] = x;
+    s->y[i] = y;
+    if (down == 0) {
+        float sx = x - s->start_x, sy = y - s->start_y;
+        switch (s->state) {
+            case _INPUT_GESTURE_POSSIBLE:
+            case _INPUT_GESTURE_LONG_PRESS:
+                if (sx * sx + sy * sy <= c->tap_slop * c->tap_slop)
+                    break;
+                s->state = _INPUT_GESTURE_PAN;
+                if ((out = _input_gesture_emit(g, SAPP_GESTURE_PAN, SAPP_GESTURE_BEGAN, time, x, y))) {
+                    out->dx = sx;
+                    out->dy = sy;
+                }
+                break;
+            case _INPUT_GESTURE_PAN:
+                // Merged changes add up their movement
+                if ((out = _input_gesture_emit(g, SAPP_GESTURE_PAN, SAPP_GESTURE_CHANGED, time, x, y))) {
+                    out->dx += dx;
+                    out->dy += dy;
+                }
+                break;
+            case _INPUT_GESTURE_TRANSFORM:
+                _input_gesture_transform(g, time);
+                break;
+            default:
+                break;
+        }
+        return;
+    }
+    if (down == -1 && s->count == 1) {
+        float sx = x - s->start_x, sy = y - s->start_y;
+        float duration = (float)(time - s->start_time);
+        if (s->state == _INPUT_GESTURE_POSSIBLE && duration <= c->tap_time) {
+            float tx = x - s->tap_x, ty = y - s->tap_y;
+            if (s->tap_time > 0. && time - s->tap_time <= c->double_tap_time && tx * tx + ty * ty <= c->double_tap_slop * c->double_tap_slop) {
+                _input_gesture_emit(g, SAPP_GESTURE_DOUBLE_TAP, SAPP_GESTURE_ENDED, time, x, y);
+                s->tap_time = 0.;
+            } else {
+                _input_gesture_emit(g, SAPP_GESTURE_TAP, SAPP_GESTURE_ENDED, time, x, y);
+                s->tap_time = time;
+                s->tap_x = x;
+                s->tap_y = y;
+            }
+        } else if (s->state == _INPUT_GESTURE_PAN && duration <= c->swipe_time && sx * sx + sy * sy >= c->swipe_distance * c->swipe_distance) {
+            if ((out = _input_gesture_emit(g, SAPP_GESTURE_SWIPE, SAPP_GESTURE_ENDED, time, x, y))) {
+                out->dx = sx;
+                out->dy = sy;
+            }
+        }
+    }
+    _input_gesture_end(g, time);
+    s->state = s->count > 1 ? _INPUT_GESTURE_WAIT : _INPUT_GESTURE_IDLE;
+    if (--s->count && i == 0) {
+        s->id[0] = s->id[1];
+        s->x[0] = s->x[1];
+        s->y[0] = s->y[1];
+    }
+}
+
+static void _input_flush_gestures(_input_gestures *g, double time) {
+    // Long presses found at the flush are reported in the next frame, like hold thresholds
+    g->count = 0;
+    _input_gesture_tick(g, time);
+}
+
+static inline unsigned _input_touch_hash(uint32_t id) {
+    return (id * 2654435761u) >> (32 - _INPUT_TOUCH_TABLE_LOG);
+}
+
+static int _input_touch_lookup(const _input_touches *t, uint32_t id) {
+    // Never more entries than slots, so there is always an empty bucket to stop at
+    for (unsigned i = _input_touch_hash(id);; i = (i + 1) & (_INPUT_TOUCH_TABLE - 1)) {
+        int entry = t->table[i];
+        if (!entry)
+            return -1;
+        if (t->id[entry - 1] == id)
+            return entry - 1;
+    }
+}
+
+static void _input_touch_map(_input_touches *t, int slot) {
+    unsigned i = _input_touch_hash(t->id[slot]);
+    while (t->table[i])
+        i = (i + 1) & (_INPUT_TOUCH_TABLE - 1);
+    t->table[i] = (uint8_t)(slot + 1);
+}
+
+static void _input_touch_unmap(_input_touches *t, int slot) {
+    const unsigned mask = _INPUT_TOUCH_TABLE - 1;
+    unsigned i = _input_touch_hash(t->id[slot]);
+    while (t->table[i] != slot + 1)
+        i = (i + 1) & mask;
+    // Backward shift deletion: pull later entries of the probe run into the hole, no tombstones
+    for (unsigned j = (i + 1) & mask; t->table[j]; j = (j + 1) & mask) {
+        unsigned home = _input_touch_hash(t->id[t->table[j] - 1]);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            t->table[i] = t->table[j];
+            i = j;
+        }
+    }
+    t->table[i] = 0;
+}
+
+static void _input_touch(sapp_input_context *ctx, const sapp_input_record *r) {
+    _input_touches *t = &ctx->touches;
+    int slot = _input_touch_lookup(t, r->modifiers);
+    if (r->type == SAPP_EVENTTYPE_TOUCHES_BEGAN) {
+        if (slot >= 0 && !(t->down & (1u << slot))) {
+            // The id was reused within the frame, the ended touch keeps its slot until the flush
+            _input_touch_unmap(t, slot);
+            slot = -1;
+        }
+        if (slot < 0) {
+            unsigned used = t->down | t->ended;
+            if (used == (1u << _INPUT_MAX_TOUCHES) - 1)
+                return;
+            slot = _input_ctz64(~used);
+            t->id[slot] = r->modifiers;
+            t->start_x[slot] = r->x;
+            t->start_y[slot] = r->y;
+            t->start_time[slot] = r->time;
+            t->began |= (uint8_t)(1u << slot);
+            _input_touch_map(t, slot);
+        }
+        t->down |= (uint8_t)(1u << slot);
+    } else if (slot < 0 || !(t->down & (1u << slot)))
+        return;
+    uint8_t bit = (uint8_t)(1u << slot);
+    int gesture = 1;
+    t->x[slot] = r->x;
+    t->y[slot] = r->y;
+    switch (r->type) {
+        case SAPP_EVENTTYPE_TOUCHES_MOVED:
+            t->moved |= bit;
+            gesture = 0;
+            break;
+        case SAPP_EVENTTYPE_TOUCHES_CANCELLED:
+            t->cancelled |= bit;
+            gesture = -2;
+            // fallthrough
+        case SAPP_EVENTTYPE_TOUCHES_ENDED:
+            t->down &= (uint8_t)~bit;
+            t->ended |= bit;
+            gesture = gesture == 1 ? -1 : gesture;
+            break;
+        default:
+            break;
+    }
+    _input_gesture_pointer(&ctx->gestures, slot, gesture, r->time, r->x, r->y);
+}
+
+static void _input_flush_touches(_input_touches *t) {
+    for (unsigned gone = t->ended & ~t->down; gone; gone &= gone - 1) {
+        int slot = _input_ctz64(gone);
+        if (_input_touch_lookup(t, t->id[slot]) == slot)
+            _input_touch_unmap(t, slot);
+    }
+    t->began = t->moved = t->ended = t->cancelled = 0;
+}
+
+static void _input_gamepad(sapp_input_context *ctx, const sapp_input_record *r) {
+    int pad = r->code >> 8, index = r->code & 0xFF;
+    if (pad >= SOKOL_INPUT_MAX_GAMEPADS)
+        return;
+    _state *s = &_INPUT_CURRENT(ctx);
+    uint32_t bit = index < 32 ? 1u << index : 0;
+    switch (r->type) {
+        case SAPP_INPUT_RECORD_GAMEPAD_CONNECTED:
+            s->gamepads |= (uint8_t)(1u << pad);
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED:
+            // Release everything so no button stays stuck down on an unplugged gamepad
+            ctx->gamepad_released[pad] |= s->gamepad_buttons[pad];
+            s->gamepad_buttons[pad] = 0;
+            for (int a = 0; a < SAPP_GAMEPAD_AXIS_COUNT; a++)
+                s->gamepad_axes[a][pad] = 0.f;
+            s->gamepads &= (uint8_t)~(1u << pad);
+            ctx->gamepad_axes.dirty = true;
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN:
+            s->gamepads |= (uint8_t)(1u << pad);
+            ctx->gamepad_pressed[pad] |= bit & ~s->gamepad_buttons[pad];
+            s->gamepad_buttons[pad] |= bit;
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP:
+            ctx->gamepad_released[pad] |= bit & s->gamepad_buttons[pad];
+            s->gamepad_buttons[pad] &= ~bit;
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_AXIS:
+            if (index < SAPP_GAMEPAD_AXIS_COUNT) {
+                s->gamepads |= (uint8_t)(1u << pad);
+                s->gamepad_axes[index][pad] = r->x;
+                ctx->gamepad_axes.dirty = true;
+            }
+            break;
+    }
+}
+
+// Rounds what the recorder quantizes the way a replay decodes it
+static void _input_rec_snap(sapp_input_record *r) {
+    const float step = (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+    if (r->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        r->dx = (float)_input_quantize(r->dx) / step;
+        r->dy = (float)_input_quantize(r->dy) / step;
+    }
+    if (r->type == SAPP_EVENTTYPE_MOUSE_MOVE || r->type == SAPP_EVENTTYPE_MOUSE_DOWN ||
+        r->type == SAPP_EVENTTYPE_MOUSE_UP || _input_is_touch(r->type)) {
+        r->x = (float)_input_quantize(r->x) / step;
+        r->y = (float)_input_quantize(r->y) / step;
+    }
+}
+
+static void _input_apply(sapp_input_context *ctx, const sapp_input_record *r) {
+    sapp_input_record snapped;
+    if (ctx->recorder.write) {
+        _input_rec_event(&ctx->recorder, r);
+        // Apply what the replay will see, so replayed queries match the live ones
+        snapped = *r;
+        _input_rec_snap(&snapped);
+        r = &snapped;
+    }
+    ctx->holds.time = _MAX(ctx->holds.time, r->time);
+    switch (r->type) {
+        case SAPP_EVENTTYPE_KEY_UP:
+        case SAPP_EVENTTYPE_KEY_DOWN:
+            if (r->code < _INPUT_MAX_KEYS)
+                _input_key(ctx, r->code, r->type == SAPP_EVENTTYPE_KEY_DOWN);
+            _input_modifiers(ctx, r->modifiers);
+            break;
+        case SAPP_EVENTTYPE_MOUSE_UP:
+        case SAPP_EVENTTYPE_MOUSE_DOWN:
+            if (r->code < _INPUT_MAX_BUTTONS)
+                _input_button(ctx, r->code, r->type == SAPP_EVENTTYPE_MOUSE_DOWN);
+            if (r->code == SAPP_MOUSEBUTTON_LEFT)
+                _input_gesture_pointer(&ctx->gestures, _INPUT_GESTURE_MOUSE, r->type == SAPP_EVENTTYPE_MOUSE_DOWN ? 1 : -1, r->time, r->x, r->y);
+            break;
+        case SAPP_EVENTTYPE_MOUSE_MOVE:
+            _INPUT_CURRENT(ctx).cursor.x = _INPUT_COORD(r->x);
+            _INPUT_CURRENT(ctx).cursor.y = _INPUT_COORD(r->y);
+            _INPUT_CURRENT(ctx).motion.x += r->dx;
+            _INPUT_CURRENT(ctx).motion.y += r->dy;
+            _input_motion_sample_add(&ctx->motion, r->time, r->x, r->y);
+            _input_gesture_pointer(&ctx->gestures, _INPUT_GESTURE_MOUSE, 0, r->time, r->x, r->y);
+            break;
+        case SAPP_EVENTTYPE_TOUCHES_BEGAN:
+        case SAPP_EVENTTYPE_TOUCHES_MOVED:
+        case SAPP_EVENTTYPE_TOUCHES_ENDED:
+        case SAPP_EVENTTYPE_TOUCHES_CANCELLED:
+            _input_touch(ctx, r);
+            break;
+        case SAPP_INPUT_RECORD_GAMEPAD_CONNECTED:
+        case SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED:
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN:
+        case SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP:
+        case SAPP_INPUT_RECORD_GAMEPAD_AXIS:
+            _input_gamepad(ctx, r);
+            break;
+        case SAPP_EVENTTYPE_MOUSE_SCROLL:
+            _INPUT_CURRENT(ctx).scroll.x += r->x;
+            _INPUT_CURRENT(ctx).scroll.y += r->y;
+#if SOKOL_INPUT_SCROLL_HISTORY > 0
+            if (ctx->scroll_count < SOKOL_INPUT_SCROLL_HISTORY) {
+                ctx->scroll_history[ctx->scroll_count].x = r->x;
+                ctx->scroll_history[ctx->scroll_count].y = r->y;
+            }
+#endif
+            ctx->scroll_count++;
+            break;
+        default:
+            _input_modifiers(ctx, r->modifiers);
+            break;
+    }
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    ctx->queue[ctx->queue_head++ % SOKOL_INPUT_EVENT_QUEUE_SIZE] = *r;
+#endif
+}
+
+static void _input_pump_push(sapp_input_context *ctx, const sapp_input_record *r) {
+    uint32_t head = ctx->pump_head;
+    if (head - _INPUT_LOAD_ACQUIRE(&ctx->pump_tail) >= SOKOL_INPUT_PUMP_QUEUE_SIZE) {
+        _INPUT_STORE_RELEASE(&ctx->pump_dropped, ctx->pump_dropped + 1);
+        return;
+    }
+    ctx->pump[head & (SOKOL_INPUT_PUMP_QUEUE_SIZE - 1)] = *r;
+    _INPUT_STORE_RELEASE(&ctx->pump_head, head + 1);
+}
+
+static void _input_submit(sapp_input_context *ctx, const sapp_input_record *r) {
+    if (ctx->threaded)
+        _input_pump_push(ctx, r);
+    else
+        _input_apply(ctx, r);
+}
+
+void sapp_ctx_input_event(sapp_input_context *ctx, const sapp_event* e) {
+    sapp_input_record r[_INPUT_MAX_TOUCHES];
+    int n = _input_translate(ctx, e, r);
+    for (int i = 0; i < n; i++)
+        _input_submit(ctx, &r[i]);
+}
+
+void sapp_ctx_input_set_threaded(sapp_input_context *ctx, bool enabled) {
+    ctx->threaded = enabled;
+}
+
+int sapp_ctx_input_pump(sapp_input_context *ctx) {
+    uint32_t tail = ctx->pump_tail;
+    uint32_t head = _INPUT_LOAD_ACQUIRE(&ctx->pump_head);
+    for (uint32_t i = tail; i != head; i++)
+        _input_apply(ctx, &ctx->pump[i & (SOKOL_INPUT_PUMP_QUEUE_SIZE - 1)]);
+    _INPUT_STORE_RELEASE(&ctx->pump_tail, head);
+    return (int)(head - tail);
+}
+
+int sapp_ctx_input_pump_dropped(sapp_input_context *ctx) {
+    return (int)_INPUT_LOAD_ACQUIRE(&ctx->pump_dropped);
+}
+
+#define _INPUT_SNAPSHOT_WORDS (sizeof(sapp_input_state) / 4)
+
+static void _input_publish(sapp_input_context *ctx) {
+    sapp_input_state s;
+    _state *cur = &_INPUT_CURRENT(ctx);
+    _state *prev = &_INPUT_PREV(ctx);
+    memset(&s, 0, sizeof(sapp_input_state));
+    s.frame = ctx->frame;
+    memcpy(s.keys, cur->keys.w, sizeof(s.keys));
+    memcpy(s.keys_pressed, ctx->pressed.w, sizeof(s.keys_pressed));
+    memcpy(s.keys_released, ctx->released.w, sizeof(s.keys_released));
+    s.buttons = cur->buttons;
+    s.buttons_pressed = ctx->buttons_pressed;
+    s.buttons_released = ctx->buttons_released;
+    s.modifiers = (uint32_t)cur->modifier;
+    s.cursor_x = _INPUT_COORD_INT(cur->cursor.x);
+    s.cursor_y = _INPUT_COORD_INT(cur->cursor.y);
+    s.cursor_dx = s.cursor_x - _INPUT_COORD_INT(prev->cursor.x);
+    s.cursor_dy = s.cursor_y - _INPUT_COORD_INT(prev->cursor.y);
+    s.cursor_xf = _INPUT_COORD_FLOAT(cur->cursor.x);
+    s.cursor_yf = _INPUT_COORD_FLOAT(cur->cursor.y);
+    s.mouse_dx = cur->motion.x;
+    s.mouse_dy = cur->motion.y;
+    s.scroll_x = cur->scroll.x;
+    s.scroll_y = cur->scroll.y;
+    // Only the flushing thread writes, so the sequence itself needs no RMW.
+    // The payload is copied word by word with relaxed atomics so readers never race on plain memory.
+    uint32_t words[_INPUT_SNAPSHOT_WORDS];
+    memcpy(words, &s, sizeof(words));
+    uint32_t seq = ctx->snapshot_seq;
+    _INPUT_STORE_RELAXED(&ctx->snapshot_seq, seq + 1);
+    _INPUT_FENCE_RELEASE();
+    for (size_t i = 0; i < _INPUT_SNAPSHOT_WORDS; i++)
+        _INPUT_STORE_RELAXED(&ctx->snapshot[i], words[i]);
+    _INPUT_STORE_RELEASE(&ctx->snapshot_seq, seq + 2);
+}
+
+void sapp_ctx_input_snapshot(sapp_input_context *ctx, sapp_input_state *out) {
+    uint32_t words[_INPUT_SNAPSHOT_WORDS];
+    for (;;) {
+        uint32_t seq = _INPUT_LOAD_ACQUIRE(&ctx->snapshot_seq);
+        if (seq & 1)
+            continue;
+        for (size_t i = 0; i < _INPUT_SNAPSHOT_WORDS; i++)
+            words[i] = _INPUT_LOAD_RELAXED(&ctx->snapshot[i]);
+        _INPUT_FENCE_ACQUIRE();
+        if (_INPUT_LOAD_RELAXED(&ctx->snapshot_seq) == seq)
+            break;
+    }
+    memcpy(out, words, sizeof(words));
+}
+
+static void _input_update_actions(sapp_input_context *ctx) {
+    _input_actions *a = &ctx->actions;
+    if (!a->dirty)
+        return;
+    const _state *cur = &_INPUT_CURRENT(ctx);
+    const _input_bindings *b = &a->bindings;
+    uint64_t tapped[_INPUT_ACTION_WORDS];
+    memset(a->down, 0, sizeof(a->down));
+    memset(tapped, 0, sizeof(tapped));
+    for (int i = 0; i < b->count; i++) {
+        if (((uint32_t)cur->modifier & b->modifiers[i]) != b->modifiers[i])
+            continue;
+        bool down, pressed;
+        if (b->kind[i] == _INPUT_BIND_KEY) {
+            down = _input_bits_test(&cur->keys, b->code[i]);
+            pressed = _input_bits_test(&ctx->pressed, b->code[i]);
+        } else {
+            down = (cur->buttons >> b->code[i]) & 1;
+            pressed = (ctx->buttons_pressed >> b->code[i]) & 1;
+        }
+        uint64_t bit = 1ull << (b->action[i] & 63);
+        if (down)
+            a->down[b->action[i] >> 6] |= bit;
+        if (pressed)
+            tapped[b->action[i] >> 6] |= bit;
+    }
+    for (int i = 0; i < _INPUT_ACTION_WORDS; i++) {
+        // A binding tapped within the frame counts as both pressed and released
+        a->pressed[i] = ~a->prev[i] & (a->down[i] | tapped[i]);
+        a->released[i] = ~a->down[i] & (a->prev[i] | tapped[i]);
+    }
+    a->dirty = false;
+    ctx->virtual_axes.dirty = true;
+}
+
+static inline bool _input_action_down(const _input_actions *a, int action) {
+    return (unsigned)action < SOKOL_INPUT_MAX_ACTIONS && ((a->down[action >> 6] >> (action & 63)) & 1);
+}
+
+static float _input_step_towards(float value, float target, float rate, float dt) {
+    if (rate <= 0.f)
+        return target;
+    float step = rate * dt;
+    return value < target ? _MIN(value + step, target) : _MAX(value - step, target);
+}
+
+static inline float _input_virtual_target(const _input_actions *a, const sapp_virtual_axis_desc *d) {
+    return (float)_input_action_down(a, d->positive) - (float)_input_action_down(a, d->negative);
+}
+
+static void _input_update_virtual_axes(sapp_input_context *ctx) {
+    _input_virtual_axes *v = &ctx->virtual_axes;
+    // Whoever re-evaluates actions or gamepad axes marks the virtual axes dirty
+    if (!v->dirty && !ctx->actions.dirty && !ctx->gamepad_axes.dirty)
+        return;
+    _input_update_actions(ctx);
+    for (int i = 0; i < v->count; i++) {
+        const sapp_virtual_axis_desc *d = &v->desc[i];
+        float target = _input_virtual_target(&ctx->actions, d), value = v->ramp[i];
+        // Instant rates and a snapping reversal show up right away, ramps advance at flush
+        if (target == 0.f)
+            value = d->gravity <= 0.f ? 0.f : value;
+        else if (d->sensitivity <= 0.f)
+            value = target;
+        else if (d->snap && value * target < 0.f)
+            value = 0.f;
+        float pad = d->use_gamepad ? sapp_ctx_gamepad_axis(ctx, d->gamepad, d->gamepad_axis) : 0.f;
+        v->value[i] = fabsf(pad) > fabsf(value) ? pad : value;
+    }
+    v->dirty = false;
+}
+
+static void _input_step_virtual_axes(sapp_input_context *ctx, float dt) {
+    _input_virtual_axes *v = &ctx->virtual_axes;
+    _input_update_actions(ctx);
+    for (int i = 0; i < v->count; i++) {
+        const sapp_virtual_axis_desc *d = &v->desc[i];
+        float target = _input_virtual_target(&ctx->actions, d), ramp = v->ramp[i];
+        if (target == 0.f)
+            ramp = _input_step_towards(ramp, 0.f, d->gravity, dt);
+        else {
+            if (d->snap && ramp * target < 0.f)
+                ramp = 0.f;
+            ramp = _input_step_towards(ramp, target, d->sensitivity, dt);
+        }
+        v->ramp[i] = ramp;
+    }
+    v->dirty = true;
+}
+
+static void _input_flush_actions(sapp_input_context *ctx) {
+    _input_actions *a = &ctx->actions;
+    _input_update_actions(ctx);
+    memcpy(a->prev, a->down, sizeof(a->prev));
+    memset(a->pressed, 0, sizeof(a->pressed));
+    memset(a->released, 0, sizeof(a->released));
+}
+
+static inline uint64_t _input_pack_signed(int32_t v, int width) {
+    int32_t limit = 1 << (width - 1);
+    v = v < -limit ? -limit : v >= limit ? limit - 1 : v;
+    return (uint64_t)(uint32_t)v & ((1ull << width) - 1);
+}
+
+static inline int32_t _input_unpack_signed(uint64_t bits, int shift, int width) {
+    int64_t sign = 1ll << (width - 1);
+    return (int32_t)((int64_t)((bits >> shift) & ((1ull << width) - 1)) ^ sign) - (int32_t)sign;
+}
+
+static void _input_history_record(sapp_input_context *ctx) {
+    _input_history *h = &ctx->history;
+    _state *cur = &_INPUT_CURRENT(ctx);
+    uint64_t keys = 0;
+    for (int i = 0; i < h->key_count; i++)
+        keys |= (uint64_t)_input_bits_test(&cur->keys, h->keys[i]) << i;
+    uint64_t *rec = h->ring[ctx->frame & (SOKOL_INPUT_HISTORY_FRAMES - 1)];
+    rec[0] = keys;
+    rec[1] = (uint64_t)(cur->buttons & 0x7) |
+             (uint64_t)(cur->modifier & 0xF) << 3 |
+             _input_pack_signed(_INPUT_COORD_INT(cur->cursor.x), 16) << 7 |
+             _input_pack_signed(_INPUT_COORD_INT(cur->cursor.y), 16) << 23 |
+             _input_pack_signed(_input_quantize(cur->scroll.x), 12) << 39 |
+             _input_pack_signed(_input_quantize(cur->scroll.y), 12) << 51;
+}
+
+void sapp_ctx_input_flush(sapp_input_context *ctx) {
+    double now = ctx->has_flush_time ? ctx->flush_time : _input_elapsed(ctx);
+    ctx->has_flush_time = false;
+    if (ctx->recorder.write)
+        _input_rec_flush(&ctx->recorder, now);
+    // Hold thresholds crossed in (prev_time, time] belong to the frame that just ended
+    ctx->holds.prev_time = ctx->holds.time;
+    ctx->holds.time = _MAX(ctx->holds.time, now);
+    _input_publish(ctx);
+    _input_history_record(ctx);
+    _input_step_virtual_axes(ctx, (float)_MAX(now - ctx->last_flush_time, 0.));
+    ctx->last_flush_time = now;
+    _input_flush_actions(ctx);
+    memset(ctx->combos.triggered, 0, sizeof(ctx->combos.triggered));
+    _input_flush_touches(&ctx->touches);
+    _input_flush_gestures(&ctx->gestures, ctx->holds.time);
+    ctx->frame++;
+    // The other slot already matches the current one except for the dirty key words
+    _state *cur = &_INPUT_CURRENT(ctx);
+    _state *next = &_INPUT_PREV(ctx);
+    next->buttons = cur->buttons;
+    next->modifier = cur->modifier;
+    next->cursor.x = cur->cursor.x;
+    next->cursor.y = cur->cursor.y;
+    next->motion.x = next->motion.y = 0.f;
+    next->scroll.x = next->scroll.y = 0.f;
+    next->gamepads = cur->gamepads;
+    memcpy(next->gamepad_buttons, cur->gamepad_buttons, sizeof(cur->gamepad_buttons));
+    memcpy(next->gamepad_axes, cur->gamepad_axes, sizeof(cur->gamepad_axes));
+    memset(ctx->gamepad_pressed, 0, sizeof(ctx->gamepad_pressed));
+    memset(ctx->gamepad_released, 0, sizeof(ctx->gamepad_released));
+    for (uint8_t d = ctx->dirty; d; d &= d - 1) {
+        int i = _input_ctz64(d);
+        next->keys.w[i] = cur->keys.w[i];
+        // Only keys that were pressed this frame can have a non-zero count
+        for (uint64_t w = ctx->pressed.w[i]; w; w &= w - 1)
+            ctx->press_count[i * 64 + _input_ctz64(w)] = 0;
+        ctx->pressed.w[i] = ctx->released.w[i] = 0;
+    }
+    ctx->dirty = 0;
+    ctx->current ^= 1;
+    ctx->scroll_count = 0;
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    ctx->queue_head = 0;
+#endif
+    memset(ctx->button_press_count, 0, sizeof(ctx->button_press_count));
+    ctx->buttons_pressed = ctx->buttons_released = 0;
+}
+
+bool sapp_ctx_is_key_down(sapp_input_context *ctx, int key) {
+    return _input_bits_test(&_INPUT_CURRENT(ctx).keys, key);
+}
+
+bool sapp_ctx_was_key_pressed(sapp_input_context *ctx, int key) {
+    return _input_bits_test(&ctx->pressed, key);
+}
+
+bool sapp_ctx_was_key_released(sapp_input_context *ctx, int key) {
+    return _input_bits_test(&ctx->released, key);
+}
+
+int sapp_ctx_key_press_count(sapp_input_context *ctx, int key) {
+    return (unsigned)key < _INPUT_MAX_KEYS ? ctx->press_count[key] : 0;
+}
+
+// all: true if every one of the n codes is down, otherwise true if any of them is
+static bool _input_keys_down(sapp_input_context *ctx, int n, va_list args, bool all) {
+    for (int i = 0; i < n; i++)
+        if (sapp_ctx_is_key_down(ctx, va_arg(args, int)) != all)
+            return !all;
+    return all;
+}
+
+bool sapp_ctx_are_keys_down(sapp_input_context *ctx, int n, ...) {
+    va_list args;
+    va_start(args, n);
+    bool result = _input_keys_down(ctx, n, args, true);
+    va_end(args);
+    return result;
+}
+
+bool sapp_ctx_any_keys_down(sapp_input_context *ctx, int n, ...) {
+    va_list args;
+    va_start(args, n);
+    bool result = _input_keys_down(ctx, n, args, false);
+    va_end(args);
+    return result;
+}
+
+static inline bool _input_button_bit(uint8_t buttons, int button) {
+    return (unsigned)button < _INPUT_MAX_BUTTONS && ((buttons >> button) & 1);
+}
+
+bool sapp_ctx_is_button_down(sapp_input_context *ctx, int button) {
+    return _input_button_bit(_INPUT_CURRENT(ctx).buttons, button);
+}
+
+bool sapp_ctx_was_button_pressed(sapp_input_context *ctx, int button) {
+    return _input_button_bit(ctx->buttons_pressed, button);
+}
+
+bool sapp_ctx_was_button_released(sapp_input_context *ctx, int button) {
+    return _input_button_bit(ctx->buttons_released, button);
+}
+
+int sapp_ctx_button_press_count(sapp_input_context *ctx, int button) {
+    return (unsigned)button < _INPUT_MAX_BUTTONS ? ctx->button_press_count[button] : 0;
+}
+
+// all: true if every one of the n codes is down, otherwise true if any of them is
+static bool _input_buttons_down(sapp_input_context *ctx, int n, va_list args, bool all) {
+    for (int i = 0; i < n; i++)
+        if (sapp_ctx_is_button_down(ctx, va_arg(args, int)) != all)
+            return !all;
+    return all;
+}
+
+bool sapp_ctx_are_buttons_down(sapp_input_context *ctx, int n, ...) {
+    va_list args;
+    va_start(args, n);
+    bool result = _input_buttons_down(ctx, n, args, true);
+    va_end(args);
+    return result;
+}
+
+bool sapp_ctx_any_buttons_down(sapp_input_context *ctx, int n, ...) {
+    va_list args;
+    va_start(args, n);
+    bool result = _input_buttons_down(ctx, n, args, false);
+    va_end(args);
+    return result;
+}
+
+bool sapp_ctx_modifier_equals(sapp_input_context *ctx, int mods) {
+    return _INPUT_CURRENT(ctx).modifier == mods;
+}
+
+bool sapp_ctx_modifier_down(sapp_input_context *ctx, int mod) {
+    return _INPUT_CURRENT(ctx).modifier & mod;
+}
+
+bool sapp_ctx_has_mouse_move(sapp_input_context *ctx) {
+    return _INPUT_CURRENT(ctx).cursor.x != _INPUT_PREV(ctx).cursor.x || _INPUT_CURRENT(ctx).cursor.y != _INPUT_PREV(ctx).cursor.y ||
+           _INPUT_CURRENT(ctx).motion.x != 0.f || _INPUT_CURRENT(ctx).motion.y != 0.f;
+}
+
+int sapp_ctx_cursor_x(sapp_input_context *ctx) {
+    return _INPUT_COORD_INT(_INPUT_CURRENT(ctx).cursor.x);
+}
+
+int sapp_ctx_cursor_y(sapp_input_context *ctx) {
+    return _INPUT_COORD_INT(_INPUT_CURRENT(ctx).cursor.y);
+}
+
+int sapp_ctx_cursor_delta_x(sapp_input_context *ctx) {
+    return _INPUT_COORD_INT(_INPUT_CURRENT(ctx).cursor.x) - _INPUT_COORD_INT(_INPUT_PREV(ctx).cursor.x);
+}
+
+int sapp_ctx_cursor_delta_y(sapp_input_context *ctx) {
+    return _INPUT_COORD_INT(_INPUT_CURRENT(ctx).cursor.y) - _INPUT_COORD_INT(_INPUT_PREV(ctx).cursor.y);
+}
+
+float sapp_ctx_cursor_xf(sapp_input_context *ctx) {
+    return _INPUT_COORD_FLOAT(_INPUT_CURRENT(ctx).cursor.x);
+}
+
+float sapp_ctx_cursor_yf(sapp_input_context *ctx) {
+    return _INPUT_COORD_FLOAT(_INPUT_CURRENT(ctx).cursor.y);
+}
+
+// Subtract before converting so fixed point deltas stay exact
+float sapp_ctx_cursor_delta_xf(sapp_input_context *ctx) {
+    return _INPUT_COORD_FLOAT(_INPUT_CURRENT(ctx).cursor.x - _INPUT_PREV(ctx).cursor.x);
+}
+
+float sapp_ctx_cursor_delta_yf(sapp_input_context *ctx) {
+    return _INPUT_COORD_FLOAT(_INPUT_CURRENT(ctx).cursor.y - _INPUT_PREV(ctx).cursor.y);
+}
+
+float sapp_ctx_mouse_raw_dx(sapp_input_context *ctx) {
+    return _INPUT_CURRENT(ctx).motion.x;
+}
+
+float sapp_ctx_mouse_raw_dy(sapp_input_context *ctx) {
+    return _INPUT_CURRENT(ctx).motion.y;
+}
+
+bool sapp_ctx_was_mouse_scrolled(sapp_input_context *ctx) {
+    return ctx->scroll_count > 0;
+}
+
+float sapp_ctx_scroll_x(sapp_input_context *ctx) {
+    return _INPUT_CURRENT(ctx).scroll.x;
+}
+
+float sapp_ctx_scroll_y(sapp_input_context *ctx) {
+    return _INPUT_CURRENT(ctx).scroll.y;
+}
+
+int sapp_ctx_scroll_event_count(sapp_input_context *ctx) {
+    return ctx->scroll_count;
+}
+
+bool sapp_ctx_scroll_event(sapp_input_context *ctx, int index, float *x, float *y) {
+#if SOKOL_INPUT_SCROLL_HISTORY > 0
+    if (index < 0 || index >= ctx->scroll_count || index >= SOKOL_INPUT_SCROLL_HISTORY)
+        return false;
+    if (x)
+        *x = ctx->scroll_history[index].x;
+    if (y)
+        *y = ctx->scroll_history[index].y;
+    return true;
+#else
+    (void)ctx; (void)index; (void)x; (void)y;
+    return false;
+#endif
+}
+
+sapp_input_iter sapp_ctx_input_records(sapp_input_context *ctx) {
+    sapp_input_iter iter = {0, 0};
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    iter.end = ctx->queue_head;
+    if (iter.end > SOKOL_INPUT_EVENT_QUEUE_SIZE)
+        iter.pos = iter.end - SOKOL_INPUT_EVENT_QUEUE_SIZE;
+#else
+    (void)ctx;
+#endif
+    return iter;
+}
+
+const sapp_input_record* sapp_ctx_input_next_record(sapp_input_context *ctx, sapp_input_iter *iter) {
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    if (iter->pos < iter->end)
+        return &ctx->queue[iter->pos++ % SOKOL_INPUT_EVENT_QUEUE_SIZE];
+#else
+    (void)ctx; (void)iter;
+#endif
+    return NULL;
+}
+
+int sapp_ctx_input_dropped_records(sapp_input_context *ctx) {
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    if (ctx->queue_head > SOKOL_INPUT_EVENT_QUEUE_SIZE)
+        return (int)(ctx->queue_head - SOKOL_INPUT_EVENT_QUEUE_SIZE);
+#else
+    (void)ctx;
+#endif
+    return 0;
+}
+
+static inline bool _input_state_bit(const uint64_t *bits, int key) {
+    return (unsigned)key < _INPUT_MAX_KEYS && ((bits[key >> 6] >> (key & 63)) & 1);
+}
+
+bool sapp_state_is_key_down(const sapp_input_state *state, int key) {
+    return _input_state_bit(state->keys, key);
+}
+
+bool sapp_state_was_key_pressed(const sapp_input_state *state, int key) {
+    return _input_state_bit(state->keys_pressed, key);
+}
+
+bool sapp_state_was_key_released(const sapp_input_state *state, int key) {
+    return _input_state_bit(state->keys_released, key);
+}
+
+bool sapp_state_is_button_down(const sapp_input_state *state, int button) {
+    return _input_button_bit(state->buttons, button);
+}
+
+bool sapp_state_was_button_pressed(const sapp_input_state *state, int button) {
+    return _input_button_bit(state->buttons_pressed, button);
+}
+
+bool sapp_state_was_button_released(const sapp_input_state *state, int button) {
+    return _input_button_bit(state->buttons_released, button);
+}
+
+void sapp_ctx_input_start_recording(sapp_input_context *ctx, sapp_input_write_func write, void *user_data) {
+    static const uint8_t header[4] = { 'S', 'I', 'R', _INPUT_REC_VERSION };
+    sapp_ctx_input_stop_recording(ctx);
+    if (!write)
+        return;
+    _input_recorder *rec = &ctx->recorder;
+    memset(rec, 0, sizeof(_input_recorder));
+    rec->write = write;
+    rec->user_data = user_data;
+    _input_rec_write(rec, header, sizeof(header));
+}
+
+void sapp_ctx_input_stop_recording(sapp_input_context *ctx) {
+    _input_recorder *rec = &ctx->recorder;
+    if (rec->write && rec->length)
+        rec->write(rec->buffer, rec->length, rec->user_data);
+    rec->write = NULL;
+    rec->length = 0;
+}
+
+bool sapp_input_replay_init(sapp_input_replay *replay, const void *data, size_t size) {
+    memset(replay, 0, sizeof(sapp_input_replay));
+    const uint8_t *bytes = (const uint8_t*)data;
+    if (!data || size < 4 || bytes[0] != 'S' || bytes[1] != 'I' || bytes[2] != 'R' || bytes[3] != _INPUT_REC_VERSION)
+        return false;
+    replay->data = bytes;
+    replay->size = size;
+    replay->pos = 4;
+    return true;
+}
+
+bool sapp_ctx_input_replay_frame(sapp_input_context *ctx, sapp_input_replay *replay) {
+    sapp_input_record r;
+    if (replay->failed || replay->pos >= replay->size)
+        return false;
+    int result;
+    while ((result = _input_replay_next(replay, &r)) > 0)
+        _input_apply(ctx, &r);
+    if (result == 0) {
+        ctx->has_flush_time = true;
+        ctx->flush_time = r.time;
+    }
+    return !replay->failed;
+}
+
+// State at a frame boundary, right after a flush. Per-frame transients are empty at that point.
+typedef struct {
+    uint64_t frame;
+    sapp_input_replay cursor;
+    uint64_t ctx_frame;
+    _state current, prev;
+    _input_holds holds;
+    _input_combo_run combo;
+    _input_motion motion;
+    _input_touches touches;
+    _input_gesture_run gesture;
+    float virtual_ramp[SOKOL_INPUT_MAX_VIRTUAL_AXES];
+    float virtual_value[SOKOL_INPUT_MAX_VIRTUAL_AXES];
+    double last_flush_time;
+} _input_keyframe;
+
+struct sapp_input_replay_file {
+    sapp_input_replay cursor;
+    uint64_t frame;
+    uint64_t interval;
+    _input_keyframe *keyframes;
+    int keyframe_count, keyframe_capacity;
+    void *map;
+    size_t size;
+#if defined(_WIN32)
+    HANDLE file, mapping;
+#endif
+};
+
+static void _input_keyframe_save(sapp_input_context *ctx, const sapp_input_replay_file *file, _input_keyframe *kf) {
+    kf->frame = file->frame;
+    kf->cursor = file->cursor;
+    kf->ctx_frame = ctx->frame;
+    kf->current = _INPUT_CURRENT(ctx);
+    kf->prev = _INPUT_PREV(ctx);
+    kf->holds = ctx->holds;
+    kf->combo = ctx->combos.run;
+    kf->motion = ctx->motion;
+    kf->touches = ctx->touches;
+    kf->gesture = ctx->gestures.run;
+    memcpy(kf->virtual_ramp, ctx->virtual_axes.ramp, sizeof(kf->virtual_ramp));
+    memcpy(kf->virtual_value, ctx->virtual_axes.value, sizeof(kf->virtual_value));
+    kf->last_flush_time = ctx->last_flush_time;
+}
+
+static void _input_keyframe_restore(sapp_input_context *ctx, sapp_input_replay_file *file, const _input_keyframe *kf) {
+    file->frame = kf->frame;
+    file->cursor = kf->cursor;
+    ctx->frame = kf->ctx_frame;
+    ctx->current = 0;
+    ctx->states[0] = kf->current;
+    ctx->states[1] = kf->prev;
+    ctx->holds = kf->holds;
+    ctx->combos.run = kf->combo;
+    ctx->motion = kf->motion;
+    ctx->touches = kf->touches;
+    ctx->gestures.run = kf->gesture;
+    ctx->gestures.count = 0;
+    memcpy(ctx->virtual_axes.ramp, kf->virtual_ramp, sizeof(kf->virtual_ramp));
+    memcpy(ctx->virtual_axes.value, kf->virtual_value, sizeof(kf->virtual_value));
+    ctx->virtual_axes.dirty = true;
+    ctx->last_flush_time = kf->last_flush_time;
+    // The ring still holds frames from before the seek, history restarts at the keyframe
+    ctx->history.start = kf->ctx_frame;
+    memset(ctx->combos.triggered, 0, sizeof(ctx->combos.triggered));
+    ctx->has_flush_time = false;
+    ctx->dirty = 0;
+    memset(&ctx->pressed, 0, sizeof(_input_bits));
+    memset(&ctx->released, 0, sizeof(_input_bits));
+    memset(ctx->press_count, 0, sizeof(ctx->press_count));
+    memset(ctx->button_press_count, 0, sizeof(ctx->button_press_count));
+    ctx->buttons_pressed = ctx->buttons_released = 0;
+    memset(ctx->gamepad_pressed, 0, sizeof(ctx->gamepad_pressed));
+    memset(ctx->gamepad_released, 0, sizeof(ctx->gamepad_released));
+    ctx->gamepad_axes.dirty = true;
+    ctx->scroll_count = 0;
+#if SOKOL_INPUT_EVENT_QUEUE_SIZE > 0
+    ctx->queue_head = 0;
+#endif
+    memset(ctx->actions.prev, 0, sizeof(ctx->actions.prev));
+    ctx->actions.dirty = true;
+    _input_flush_actions(ctx);
+}
+
+static bool _input_map_file(sapp_input_replay_file *file, const char *path) {
+#if defined(_WIN32)
+    LARGE_INTEGER size;
+    file->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file->file == INVALID_HANDLE_VALUE)
+        return false;
+    if (!GetFileSizeEx(file->file, &size) || size.QuadPart == 0)
+        return false;
+    file->mapping = CreateFileMappingA(file->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!file->mapping)
+        return false;
+    file->map = MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0);
+    file->size = (size_t)size.QuadPart;
+    return file->map != NULL;
+#else
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    if (fstat(fd, &st) || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return false;
+    file->map = map;
+    file->size = (size_t)st.st_size;
+    return true;
+#endif
+}
+
+void sapp_input_close_replay(sapp_input_replay_file *file) {
+    if (!file)
+        return;
+#if defined(_WIN32)
+    if (file->map)
+        UnmapViewOfFile(file->map);
+    if (file->mapping)
+        CloseHandle(file->mapping);
+    if (file->file && file->file != INVALID_HANDLE_VALUE)
+        CloseHandle(file->file);
+#else
+    if (file->map)
+        munmap(file->map, file->size);
+#endif
+    if (file->keyframes)
+        SOKOL_INPUT_FREE(file->keyframes);
+    SOKOL_INPUT_FREE(file);
+}
+
+sapp_input_replay_file* sapp_input_open_replay(const char *path, int keyframe_interval) {
+    sapp_input_replay_file *file = (sapp_input_replay_file*)SOKOL_INPUT_MALLOC(sizeof(sapp_input_replay_file));
+    if (!file)
+        return NULL;
+    memset(file, 0, sizeof(sapp_input_replay_file));
+    if (!_input_map_file(file, path) || !sapp_input_replay_init(&file->cursor, file->map, file->size)) {
+        sapp_input_close_replay(file);
+        return NULL;
+    }
+    file->interval = keyframe_interval > 0 ? (uint64_t)keyframe_interval : SOKOL_INPUT_REPLAY_KEYFRAME_INTERVAL;
+    return file;
+}
+
+uint64_t sapp_input_replay_tell(sapp_input_replay_file *file) {
+    return file->frame;
+}
+
+bool sapp_ctx_input_replay_file_frame(sapp_input_context *ctx, sapp_input_replay_file *file) {
+    // Keyframes are appended in order the first time playback reaches each interval boundary
+    uint64_t next = (uint64_t)file->keyframe_count * file->interval;
+    if (file->frame == next) {
+        if (file->keyframe_count == file->keyframe_capacity) {
+            int capacity = file->keyframe_capacity ? file->keyframe_capacity * 2 : 16;
+            _input_keyframe *keyframes = (_input_keyframe*)SOKOL_INPUT_MALLOC(sizeof(_input_keyframe) * (size_t)capacity);
+            if (!keyframes)
+                return false;
+            if (file->keyframes) {
+                memcpy(keyframes, file->keyframes, sizeof(_input_keyframe) * (size_t)file->keyframe_count);
+                SOKOL_INPUT_FREE(file->keyframes);
+            }
+            file->keyframes = keyframes;
+            file->keyframe_capacity = capacity;
+        }
+        _input_keyframe_save(ctx, file, &file->keyframes[file->keyframe_count++]);
+    }
+    if (!sapp_ctx_input_replay_frame(ctx, &file->cursor))
+        return false;
+    file->frame++;
+    return true;
+}
+
+bool sapp_ctx_input_seek_replay(sapp_input_context *ctx, sapp_input_replay_file *file, uint64_t frame) {
+    if (!file->keyframe_count) {
+        // Nothing replayed yet, the first keyframe is the context as it is now
+        if (!sapp_ctx_input_replay_file_frame(ctx, file))
+            return false;
+        sapp_ctx_input_flush(ctx);
+    }
+    int lo = 0, hi = file->keyframe_count - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (file->keyframes[mid].frame <= frame)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    _input_keyframe_restore(ctx, file, &file->keyframes[lo]);
+    while (file->frame < frame) {
+        if (!sapp_ctx_input_replay_file_frame(ctx, file))
+            return false;
+        sapp_ctx_input_flush(ctx);
+    }
+    return true;
+}
+
+int sapp_ctx_input_find_action(sapp_input_context *ctx, const char *name) {
+    for (int i = 0; i < ctx->actions.count; i++)
+        if (!strncmp(ctx->actions.names[i], name, _INPUT_ACTION_NAME - 1))
+            return i;
+    return -1;
+}
+
+int sapp_ctx_input_register_action(sapp_input_context *ctx, const char *name) {
+    int id = sapp_ctx_input_find_action(ctx, name);
+    if (id >= 0)
+        return id;
+    if (ctx->actions.count >= SOKOL_INPUT_MAX_ACTIONS)
+        return -1;
+    id = ctx->actions.count++;
+    strncpy(ctx->actions.names[id], name, _INPUT_ACTION_NAME - 1);
+    ctx->actions.names[id][_INPUT_ACTION_NAME - 1] = '\0';
+    return id;
+}
+
+static bool _input_bind(sapp_input_context *ctx, int action, int kind, int code, int modifiers) {
+    _input_bindings *b = &ctx->actions.bindings;
+    if (action < 0 || action >= ctx->actions.count || b->count >= SOKOL_INPUT_MAX_BINDINGS)
+        return false;
+    b->action[b->count] = (uint16_t)action;
+    b->code[b->count] = (uint16_t)code;
+    b->kind[b->count] = (uint8_t)kind;
+    b->modifiers[b->count] = (uint32_t)modifiers;
+    b->count++;
+    ctx->actions.dirty = true;
+    return true;
+}
+
+bool sapp_ctx_input_bind_key(sapp_input_context *ctx, int action, int key, int modifiers) {
+    return (unsigned)key < _INPUT_MAX_KEYS && _input_bind(ctx, action, _INPUT_BIND_KEY, key, modifiers);
+}
+
+bool sapp_ctx_input_bind_button(sapp_input_context *ctx, int action, int button, int modifiers) {
+    return (unsigned)button < _INPUT_MAX_BUTTONS && _input_bind(ctx, action, _INPUT_BIND_BUTTON, button, modifiers);
+}
+
+void sapp_ctx_input_unbind_action(sapp_input_context *ctx, int action) {
+    _input_bindings *b = &ctx->actions.bindings;
+    for (int i = 0; i < b->count;)
+        if (b->action[i] == action) {
+            b->count--;
+            b->action[i] = b->action[b->count];
+            b->code[i] = b->code[b->count];
+            b->kind[i] = b->kind[b->count];
+            b->modifiers[i] = b->modifiers[b->count];
+        } else
+            i++;
+    ctx->actions.dirty = true;
+}
+
+static inline bool _input_action_bit(sapp_input_context *ctx, const uint64_t *bits, int action) {
+    if ((unsigned)action >= SOKOL_INPUT_MAX_ACTIONS)
+        return false;
+    _input_update_actions(ctx);
+    return (bits[action >> 6] >> (action & 63)) & 1;
+}
+
+bool sapp_ctx_action_down(sapp_input_context *ctx, int action) {
+    return _input_action_bit(ctx, ctx->actions.down, action);
+}
+
+bool sapp_ctx_action_pressed(sapp_input_context *ctx, int action) {
+    return _input_action_bit(ctx, ctx->actions.pressed, action);
+}
+
+bool sapp_ctx_action_released(sapp_input_context *ctx, int action) {
+    return _input_action_bit(ctx, ctx->actions.released, action);
+}
+
+int sapp_ctx_input_add_virtual_axis(sapp_input_context *ctx, const sapp_virtual_axis_desc *desc) {
+    _input_virtual_axes *v = &ctx->virtual_axes;
+    if (v->count >= SOKOL_INPUT_MAX_VIRTUAL_AXES)
+        return -1;
+    int id = v->count++;
+    v->desc[id] = *desc;
+    v->ramp[id] = 0.f;
+    v->dirty = true;
+    return id;
+}
+
+void sapp_ctx_input_clear_virtual_axes(sapp_input_context *ctx) {
+    ctx->virtual_axes.count = 0;
+}
+
+float sapp_ctx_virtual_axis(sapp_input_context *ctx, int axis) {
+    if (axis < 0 || axis >= ctx->virtual_axes.count)
+        return 0.f;
+    _input_update_virtual_axes(ctx);
+    return ctx->virtual_axes.value[axis];
+}
+
+const float *sapp_ctx_virtual_axes(sapp_input_context *ctx, int *count) {
+    _input_update_virtual_axes(ctx);
+    if (count)
+        *count = ctx->virtual_axes.count;
+    return ctx->virtual_axes.value;
+}
+
+sapp_chord sapp_chord_make(const int *keys, int n) {
+    sapp_chord chord;
+    memset(&chord, 0, sizeof(sapp_chord));
+    for (int i = 0; i < n; i++)
+        if ((unsigned)keys[i] < _INPUT_MAX_KEYS)
+            chord.keys[keys[i] >> 6] |= 1ull << (keys[i] & 63);
+    return chord;
+}
+
+bool sapp_ctx_chord_all_down(sapp_input_context *ctx, const sapp_chord *chord) {
+    return _input_bits_intersects(chord->keys, chord->keys) && _input_bits_contains(_INPUT_CURRENT(ctx).keys.w, chord->keys);
+}
+
+bool sapp_ctx_chord_any_down(sapp_input_context *ctx, const sapp_chord *chord) {
+    return _input_bits_intersects(_INPUT_CURRENT(ctx).keys.w, chord->keys);
+}
+
+bool sapp_ctx_chord_pressed(sapp_input_context *ctx, const sapp_chord *chord) {
+    return _input_bits_intersects(ctx->pressed.w, chord->keys) && _input_bits_contains(_INPUT_CURRENT(ctx).keys.w, chord->keys);
+}
+
+int sapp_ctx_input_register_combo(sapp_input_context *ctx, const int *steps, const float *timeouts, int count) {
+    _input_combos *c = &ctx->combos;
+    if (c->count >= SOKOL_INPUT_MAX_COMBOS || count < 1 || count > SOKOL_INPUT_MAX_COMBO_STEPS)
+        return -1;
+    int symbols = c->symbols;
+    for (int i = 0; i < count; i++)
+        if ((unsigned)steps[i] >= _INPUT_COMBO_ALPHABET)
+            return -1;
+    for (int i = 0; i < count; i++)
+        if (!c->symbol[steps[i]]) {
+            if (symbols >= SOKOL_INPUT_MAX_COMBO_SYMBOLS) {
+                // Undo the symbols this combo added
+                for (int j = 0; j < i; j++)
+                    if (c->symbol[steps[j]] > c->symbols)
+                        c->symbol[steps[j]] = 0;
+                return -1;
+            }
+            c->symbol[steps[i]] = (uint8_t)++symbols;
+        }
+    int id = c->count++;
+    c->symbols = symbols;
+    c->length[id] = (uint8_t)count;
+    for (int i = 0; i < count; i++) {
+        c->steps[id][i] = (uint16_t)steps[i];
+        c->timeouts[id][i] = timeouts ? timeouts[i] : SOKOL_INPUT_COMBO_TIMEOUT;
+    }
+    c->dirty = true;
+    c->run.node = 0;
+    return id;
+}
+
+void sapp_ctx_input_clear_combos(sapp_input_context *ctx) {
+    memset(&ctx->combos, 0, sizeof(_input_combos));
+}
+
+bool sapp_ctx_combo_triggered(sapp_input_context *ctx, int combo) {
+    return (unsigned)combo < SOKOL_INPUT_MAX_COMBOS && ((ctx->combos.triggered[combo >> 6] >> (combo & 63)) & 1);
+}
+
+static inline float _input_hold_time(const _input_holds *holds, uint32_t pressed) {
+    return (float)((double)(_input_ticks(holds->time) - pressed) / 1e6);
+}
+
+// The delay ends in (prev_time, time], a press within that span has been held for less than the span
+static inline bool _input_hold_started(const _input_holds *holds, uint32_t pressed) {
+    uint32_t now = _input_ticks(holds->time), delay = _input_ticks(SOKOL_KEY_HOLD_DELAY);
+    uint32_t held = now - pressed, span = now - _input_ticks(holds->prev_time);
+    return held >= delay && (held < span || held - span < delay);
+}
+
+float sapp_ctx_key_hold_time(sapp_input_context *ctx, int key) {
+    return sapp_ctx_is_key_down(ctx, key) ? _input_hold_time(&ctx->holds, ctx->holds.keys[key]) : 0.f;
+}
+
+bool sapp_ctx_is_key_held(sapp_input_context *ctx, int key) {
+    return sapp_ctx_is_key_down(ctx, key) && sapp_ctx_key_hold_time(ctx, key) >= SOKOL_KEY_HOLD_DELAY;
+}
+
+bool sapp_ctx_was_key_hold_started(sapp_input_context *ctx, int key) {
+    return sapp_ctx_is_key_down(ctx, key) && _input_hold_started(&ctx->holds, ctx->holds.keys[key]);
+}
+
+float sapp_ctx_button_hold_time(sapp_input_context *ctx, int button) {
+    return sapp_ctx_is_button_down(ctx, button) ? _input_hold_time(&ctx->holds, ctx->holds.buttons[button]) : 0.f;
+}
+
+bool sapp_ctx_is_button_held(sapp_input_context *ctx, int button) {
+    return sapp_ctx_is_button_down(ctx, button) && sapp_ctx_button_hold_time(ctx, button) >= SOKOL_KEY_HOLD_DELAY;
+}
+
+bool sapp_ctx_was_button_hold_started(sapp_input_context *ctx, int button) {
+    return sapp_ctx_is_button_down(ctx, button) && _input_hold_started(&ctx->holds, ctx->holds.buttons[button]);
+}
+
+bool sapp_ctx_input_set_history_keys(sapp_input_context *ctx, const int *keys, int n) {
+    _input_history *h = &ctx->history;
+    uint16_t list[_INPUT_HISTORY_KEYS];
+    int count = 0;
+    if (keys) {
+        if (n < 0 || n > _INPUT_HISTORY_KEYS)
+            return false;
+        for (; count < n; count++) {
+            if ((unsigned)keys[count] >= _INPUT_MAX_KEYS)
+                return false;
+            list[count] = (uint16_t)keys[count];
+        }
+    } else {
+        _input_bindings *b = &ctx->actions.bindings;
+        _input_bits seen;
+        memset(&seen, 0, sizeof(_input_bits));
+        for (int i = 0; i < b->count; i++) {
+            if (b->kind[i] != _INPUT_BIND_KEY || _input_bits_test(&seen, b->code[i]))
+                continue;
+            if (count >= _INPUT_HISTORY_KEYS)
+                return false;
+            _input_bits_assign(&seen, b->code[i], true);
+            list[count++] = b->code[i];
+        }
+    }
+    memcpy(h->keys, list, count * sizeof(uint16_t));
+    h->key_count = count;
+    h->start = ctx->frame;
+    return true;
+}
+
+bool sapp_ctx_input_history_frame(sapp_input_context *ctx, uint64_t frame, sapp_input_frame *out) {
+    _input_history *h = &ctx->history;
+    if (frame < h->start || frame >= ctx->frame || ctx->frame - frame > SOKOL_INPUT_HISTORY_FRAMES)
+        return false;
+    const uint64_t *rec = h->ring[frame & (SOKOL_INPUT_HISTORY_FRAMES - 1)];
+    out->frame = frame;
+    out->keys = rec[0];
+    out->bits = rec[1];
+    return true;
+}
+
+static void _input_decode_keys(const _input_history *h, uint64_t keys, uint64_t *out) {
+    for (; keys; keys &= keys - 1) {
+        int i = _input_ctz64(keys);
+        if (i < h->key_count)
+            out[h->keys[i] >> 6] |= 1ull << (h->keys[i] & 63);
+    }
+}
+
+void sapp_ctx_input_decode_frame(sapp_input_context *ctx, const sapp_input_frame *frame, const sapp_input_frame *prev, sapp_input_state *out) {
+    const _input_history *h = &ctx->history;
+    memset(out, 0, sizeof(sapp_input_state));
+    out->frame = frame->frame;
+    out->buttons = (uint8_t)(frame->bits & 0x7);
+    out->modifiers = (uint32_t)(frame->bits >> 3) & 0xF;
+    out->cursor_x = _input_unpack_signed(frame->bits, 7, 16);
+    out->cursor_y = _input_unpack_signed(frame->bits, 23, 16);
+    out->scroll_x = (float)_input_unpack_signed(frame->bits, 39, 12) / (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+    out->scroll_y = (float)_input_unpack_signed(frame->bits, 51, 12) / (float)SOKOL_INPUT_RECORD_SUBPIXEL;
+    _input_decode_keys(h, frame->keys, out->keys);
+    if (prev) {
+        uint8_t buttons = (uint8_t)(prev->bits & 0x7);
+        _input_decode_keys(h, frame->keys & ~prev->keys, out->keys_pressed);
+        _input_decode_keys(h, prev->keys & ~frame->keys, out->keys_released);
+        out->buttons_pressed = out->buttons & ~buttons;
+        out->buttons_released = buttons & ~out->buttons;
+        out->cursor_dx = out->cursor_x - _input_unpack_signed(prev->bits, 7, 16);
+        out->cursor_dy = out->cursor_y - _input_unpack_signed(prev->bits, 23, 16);
+    }
+}
+
+sapp_input_frame sapp_input_frame_diff(const sapp_input_frame *a, const sapp_input_frame *b) {
+    sapp_input_frame diff;
+    diff.frame = b->frame;
+    diff.keys = a->keys ^ b->keys;
+    diff.bits = a->bits ^ b->bits;
+    return diff;
+}
+
+// Packet: varint first frame, varint count, then per frame a byte saying which of keys (1) and
+// bits (2) differ from the frame before, each followed by the new word in little endian
+static uint8_t* _input_put_u64(uint8_t *p, uint64_t v) {
+    for (int i = 0; i < 8; i++)
+        *p++ = (uint8_t)(v >> (i * 8));
+    return p;
+}
+
+size_t sapp_ctx_input_history_pack(sapp_input_context *ctx, uint64_t first, int count, void *buffer, size_t size) {
+    uint8_t *start = (uint8_t*)buffer, *p = start;
+    uint64_t keys = 0, bits = 0;
+    // The header takes at most 15 bytes
+    if (count < 0 || size < 15)
+        return 0;
+    p = _input_put_varint(p, first);
+    p = _input_put_varint(p, (uint64_t)count);
+    for (int i = 0; i < count; i++) {
+        sapp_input_frame f;
+        if (!sapp_ctx_input_history_frame(ctx, first + i, &f) || (size_t)(p - start) + 17 > size)
+            return 0;
+        uint8_t *mask = p++;
+        *mask = 0;
+        if (f.keys != keys) {
+            *mask |= 1;
+            p = _input_put_u64(p, keys = f.keys);
+        }
+        if (f.bits != bits) {
+            *mask |= 2;
+            p = _input_put_u64(p, bits = f.bits);
+        }
+    }
+    return (size_t)(p - start);
+}
+
+static bool _input_get_u64(sapp_input_replay *rp, uint64_t *v) {
+    if (rp->size - rp->pos < 8)
+        return false;
+    *v = 0;
+    for (int i = 0; i < 8; i++)
+        *v |= (uint64_t)rp->data[rp->pos++] << (i * 8);
+    return true;
+}
+
+int sapp_input_unpack_frames(const void *data, size_t size, sapp_input_frame *out, int max) {
+    sapp_input_replay rp;
+    uint64_t first, count, keys = 0, bits = 0;
+    memset(&rp, 0, sizeof(sapp_input_replay));
+    rp.data = (const uint8_t*)data;
+    rp.size = size;
+    if (!_input_get_varint(&rp, &first) || !_input_get_varint(&rp, &count) || count > (uint64_t)max)
+        return -1;
+    for (uint64_t i = 0; i < count; i++) {
+        if (rp.pos >= rp.size)
+            return -1;
+        uint8_t mask = rp.data[rp.pos++];
+        if (((mask & 1) && !_input_get_u64(&rp, &keys)) || ((mask & 2) && !_input_get_u64(&rp, &bits)))
+            return -1;
+        out[i].frame = first + i;
+        out[i].keys = keys;
+        out[i].bits = bits;
+    }
+    return (int)count;
+}
+
+int sapp_ctx_cursor_sample_count(sapp_input_context *ctx) {
+    return ctx->motion.count;
+}
+
+static inline const _input_motion_sample* _input_motion_get(const _input_motion *m, int index) {
+    return &m->samples[(m->head - 1 - index) & (SOKOL_INPUT_MOTION_HISTORY - 1)];
+}
+
+bool sapp_ctx_cursor_sample(sapp_input_context *ctx, int index, double *time, float *x, float *y) {
+    if (index < 0 || index >= ctx->motion.count)
+        return false;
+    const _input_motion_sample *s = _input_motion_get(&ctx->motion, index);
+    if (time)
+        *time = s->time;
+    if (x)
+        *x = s->x;
+    if (y)
+        *y = s->y;
+    return true;
+}
+
+static inline bool _input_motion_moving(sapp_input_context *ctx) {
+    return ctx->motion.count > 0 && ctx->holds.time - ctx->motion.filter.time <= SOKOL_INPUT_MOTION_TIMEOUT;
+}
+
+void sapp_ctx_cursor_velocity(sapp_input_context *ctx, float *vx, float *vy) {
+    bool moving = _input_motion_moving(ctx);
+    if (vx)
+        *vx = moving ? ctx->motion.filter.vx : 0.f;
+    if (vy)
+        *vy = moving ? ctx->motion.filter.vy : 0.f;
+}
+
+void sapp_ctx_cursor_acceleration(sapp_input_context *ctx, float *ax, float *ay) {
+    bool moving = _input_motion_moving(ctx);
+    if (ax)
+        *ax = moving ? ctx->motion.filter.ax : 0.f;
+    if (ay)
+        *ay = moving ? ctx->motion.filter.ay : 0.f;
+}
+
+void sapp_ctx_cursor_predict(sapp_input_context *ctx, float ms, int mode, float *x, float *y) {
+    const _input_motion *m = &ctx->motion;
+    float px = _INPUT_COORD_FLOAT(_INPUT_CURRENT(ctx).cursor.x);
+    float py = _INPUT_COORD_FLOAT(_INPUT_CURRENT(ctx).cursor.y);
+    if (_input_motion_moving(ctx)) {
+        const _input_motion_sample *last = _input_motion_get(m, 0);
+        float dt = (float)(ctx->holds.time - last->time) + ms / 1000.f;
+        if (mode == SAPP_CURSOR_PREDICT_FILTERED) {
+            px = m->filter.x + m->filter.vx * dt + .5f * m->filter.ax * dt * dt;
+            py = m->filter.y + m->filter.vy * dt + .5f * m->filter.ay * dt * dt;
+        } else {
+            // Average over the window rather than the last pair, which is mostly noise at high polling rates
+            const _input_motion_sample *first = last;
+            for (int i = 1; i < m->count; i++) {
+                const _input_motion_sample *s = _input_motion_get(m, i);
+                first = s;
+                if (last->time - s->time >= SOKOL_INPUT_MOTION_WINDOW)
+                    break;
+            }
+            float span = (float)(last->time - first->time);
+            px = last->x;
+            py = last->y;
+            if (span > 0.f) {
+                px += (last->x - first->x) / span * dt;
+                py += (last->y - first->y) / span * dt;
+            }
+        }
+    }
+    if (x)
+        *x = px;
+    if (y)
+        *y = py;
+}
+
+int sapp_ctx_touches_down(sapp_input_context *ctx) {
+    return ctx->touches.down;
+}
+
+int sapp_ctx_touches_began(sapp_input_context *ctx) {
+    return ctx->touches.began;
+}
+
+int sapp_ctx_touches_moved(sapp_input_context *ctx) {
+    return ctx->touches.moved;
+}
+
+int sapp_ctx_touches_ended(sapp_input_context *ctx) {
+    return ctx->touches.ended;
+}
+
+int sapp_ctx_touches_cancelled(sapp_input_context *ctx) {
+    return ctx->touches.cancelled;
+}
+
+int sapp_ctx_touch_count(sapp_input_context *ctx) {
+    int count = 0;
+    for (unsigned down = ctx->touches.down; down; down &= down - 1)
+        count++;
+    return count;
+}
+
+int sapp_ctx_touch_find(sapp_input_context *ctx, uintptr_t identifier) {
+    return _input_touch_lookup(&ctx->touches, _input_touch_id(identifier));
+}
+
+static inline bool _input_touch_used(const _input_touches *t, int slot) {
+    return (unsigned)slot < _INPUT_MAX_TOUCHES && ((t->down | t->ended) & (1u << slot));
+}
+
+bool sapp_ctx_touch_position(sapp_input_context *ctx, int slot, float *x, float *y) {
+    const _input_touches *t = &ctx->touches;
+    if (!_input_touch_used(t, slot))
+        return false;
+    if (x)
+        *x = t->x[slot];
+    if (y)
+        *y = t->y[slot];
+    return true;
+}
+
+bool sapp_ctx_touch_start(sapp_input_context *ctx, int slot, float *x, float *y, double *time) {
+    const _input_touches *t = &ctx->touches;
+    if (!_input_touch_used(t, slot))
+        return false;
+    if (x)
+        *x = t->start_x[slot];
+    if (y)
+        *y = t->start_y[slot];
+    if (time)
+        *time = t->start_time[slot];
+    return true;
+}
+
+sapp_gesture_config sapp_ctx_input_gesture_config(sapp_input_context *ctx) {
+    return ctx->gestures.config;
+}
+
+void sapp_ctx_input_set_gesture_config(sapp_input_context *ctx, const sapp_gesture_config *config) {
+    ctx->gestures.config = *config;
+}
+
+int sapp_ctx_gesture_count(sapp_input_context *ctx) {
+    return ctx->gestures.count;
+}
+
+bool sapp_ctx_gesture_event(sapp_input_context *ctx, int index, sapp_gesture *out) {
+    if (index < 0 || index >= ctx->gestures.count)
+        return false;
+    *out = ctx->gestures.queue[index];
+    return true;
+}
+
+bool sapp_ctx_was_gesture(sapp_input_context *ctx, int type) {
+    for (int i = 0; i < ctx->gestures.count; i++)
+        if (ctx->gestures.queue[i].type == type)
+            return true;
+    return false;
+}
+
+// Four float lanes, one gamepad per lane
+#if defined(_INPUT_AVX2) || defined(_INPUT_SSE2)
+typedef __m128 _input_f4;
+static inline _input_f4 _input_f4_load(const float *p) { return _mm_loadu_ps(p); }
+static inline void _input_f4_store(float *p, _input_f4 v) { _mm_storeu_ps(p, v); }
+static inline _input_f4 _input_f4_set(float s) { return _mm_set1_ps(s); }
+static inline _input_f4 _input_f4_add(_input_f4 a, _input_f4 b) { return _mm_add_ps(a, b); }
+static inline _input_f4 _input_f4_sub(_input_f4 a, _input_f4 b) { return _mm_sub_ps(a, b); }
+static inline _input_f4 _input_f4_mul(_input_f4 a, _input_f4 b) { return _mm_mul_ps(a, b); }
+static inline _input_f4 _input_f4_div(_input_f4 a, _input_f4 b) { return _mm_div_ps(a, b); }
+static inline _input_f4 _input_f4_min(_input_f4 a, _input_f4 b) { return _mm_min_ps(a, b); }
+static inline _input_f4 _input_f4_max(_input_f4 a, _input_f4 b) { return _mm_max_ps(a, b); }
+static inline _input_f4 _input_f4_sqrt(_input_f4 a) { return _mm_sqrt_ps(a); }
+static inline _input_f4 _input_f4_abs(_input_f4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+// The magnitude of a with the sign of b
+static inline _input_f4 _input_f4_copysign(_input_f4 a, _input_f4 b) {
+    __m128 sign = _mm_set1_ps(-0.f);
+    return _mm_or_ps(_mm_andnot_ps(sign, a), _mm_and_ps(sign, b));
+}
+// a > b ? x : 0
+static inline _input_f4 _input_f4_gt_or_zero(_input_f4 a, _input_f4 b, _input_f4 x) { return _mm_and_ps(_mm_cmpgt_ps(a, b), x); }
+#elif defined(_INPUT_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+typedef float32x4_t _input_f4;
+static inline _input_f4 _input_f4_load(const float *p) { return vld1q_f32(p); }
+static inline void _input_f4_store(float *p, _input_f4 v) { vst1q_f32(p, v); }
+static inline _input_f4 _input_f4_set(float s) { return vdupq_n_f32(s); }
+static inline _input_f4 _input_f4_add(_input_f4 a, _input_f4 b) { return vaddq_f32(a, b); }
+static inline _input_f4 _input_f4_sub(_input_f4 a, _input_f4 b) { return vsubq_f32(a, b); }
+static inline _input_f4 _input_f4_mul(_input_f4 a, _input_f4 b) { return vmulq_f32(a, b); }
+static inline _input_f4 _input_f4_div(_input_f4 a, _input_f4 b) { return vdivq_f32(a, b); }
+static inline _input_f4 _input_f4_min(_input_f4 a, _input_f4 b) { return vminq_f32(a, b); }
+static inline _input_f4 _input_f4_max(_input_f4 a, _input_f4 b) { return vmaxq_f32(a, b); }
+static inline _input_f4 _input_f4_sqrt(_input_f4 a) { return vsqrtq_f32(a); }
+static inline _input_f4 _input_f4_abs(_input_f4 a) { return vabsq_f32(a); }
+static inline _input_f4 _input_f4_copysign(_input_f4 a, _input_f4 b) { return vbslq_f32(vdupq_n_u32(0x80000000u), b, a); }
+static inline _input_f4 _input_f4_gt_or_zero(_input_f4 a, _input_f4 b, _input_f4 x) {
+    return vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(a, b), vreinterpretq_u32_f32(x)));
+}
+#else
+typedef struct {
+    float v[4];
+} _input_f4;
+#define _INPUT_F4_MAP(EXPR) \
+    _input_f4 r; \
+    for (int i = 0; i < 4; i++) \
+        r.v[i] = (EXPR); \
+    return r
+static inline _input_f4 _input_f4_load(const float *p) { _INPUT_F4_MAP(p[i]); }
+static inline void _input_f4_store(float *p, _input_f4 v) { memcpy(p, v.v, sizeof(v.v)); }
+static inline _input_f4 _input_f4_set(float s) { _INPUT_F4_MAP(s); }
+static inline _input_f4 _input_f4_add(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(a.v[i] + b.v[i]); }
+static inline _input_f4 _input_f4_sub(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(a.v[i] - b.v[i]); }
+static inline _input_f4 _input_f4_mul(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(a.v[i] * b.v[i]); }
+static inline _input_f4 _input_f4_div(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(a.v[i] / b.v[i]); }
+static inline _input_f4 _input_f4_min(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(_MIN(a.v[i], b.v[i])); }
+static inline _input_f4 _input_f4_max(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(_MAX(a.v[i], b.v[i])); }
+static inline _input_f4 _input_f4_sqrt(_input_f4 a) { _INPUT_F4_MAP(sqrtf(a.v[i])); }
+static inline _input_f4 _input_f4_abs(_input_f4 a) { _INPUT_F4_MAP(fabsf(a.v[i])); }
+static inline _input_f4 _input_f4_copysign(_input_f4 a, _input_f4 b) { _INPUT_F4_MAP(copysignf(a.v[i], b.v[i])); }
+static inline _input_f4 _input_f4_gt_or_zero(_input_f4 a, _input_f4 b, _input_f4 x) { _INPUT_F4_MAP(a.v[i] > b.v[i] ? x.v[i] : 0.f); }
+#endif
+
+// Distance from the center (0..1) to output: deadzone, saturation, curve, then anti-deadzone, clamped to 1
+static inline _input_f4 _input_response_apply(const _input_response *r, _input_f4 m) {
+    _input_f4 zero = _input_f4_set(0.f), one = _input_f4_set(1.f);
+    _input_f4 t = _input_f4_mul(_input_f4_sub(m, _input_f4_set(r->deadzone)), _input_f4_set(r->scale));
+    t = _input_f4_min(_input_f4_max(t, zero), one);
+    if (r->curve == SAPP_GAMEPAD_CURVE_QUADRATIC)
+        t = _input_f4_mul(t, t);
+    else if (r->curve == SAPP_GAMEPAD_CURVE_CUSTOM) {
+        // Piecewise linear without gathers: each segment adds its rise times how far t is through it
+        _input_f4 u = _input_f4_mul(t, _input_f4_set((float)(SAPP_GAMEPAD_CURVE_POINTS - 1))), f = _input_f4_set(r->base);
+        for (int k = 0; k < SAPP_GAMEPAD_CURVE_POINTS - 1; k++) {
+            _input_f4 through = _input_f4_min(_input_f4_max(_input_f4_sub(u, _input_f4_set((float)k)), zero), one);
+            f = _input_f4_add(f, _input_f4_mul(_input_f4_set(r->steps[k]), through));
+        }
+        t = f;
+    }
+    t = _input_f4_add(_input_f4_set(r->anti_deadzone), _input_f4_mul(_input_f4_set(r->gain), t));
+    return _input_f4_gt_or_zero(m, _input_f4_set(r->deadzone), _input_f4_min(_input_f4_max(t, zero), one));
+}
+
+static void _input_stick_apply(const _input_response *r, const float *in_x, const float *in_y, float *out_x, float *out_y) {
+    _input_f4 x = _input_f4_load(in_x), y = _input_f4_load(in_y);
+    if (r->deadzone_mode == SAPP_GAMEPAD_DEADZONE_AXIAL) {
+        x = _input_f4_copysign(_input_response_apply(r, _input_f4_abs(x)), x);
+        y = _input_f4_copysign(_input_response_apply(r, _input_f4_abs(y)), y);
+        // Both axes at full deflection would reach past the unit circle
+        _input_f4 length = _input_f4_sqrt(_input_f4_add(_input_f4_mul(x, x), _input_f4_mul(y, y)));
+        _input_f4 k = _input_f4_div(_input_f4_set(1.f), _input_f4_max(length, _input_f4_set(1.f)));
+        x = _input_f4_mul(x, k);
+        y = _input_f4_mul(y, k);
+    } else {
+        _input_f4 m = _input_f4_sqrt(_input_f4_add(_input_f4_mul(x, x), _input_f4_mul(y, y)));
+        _input_f4 k = _input_f4_div(_input_response_apply(r, m), _input_f4_max(m, _input_f4_set(1e-6f)));
+        x = _input_f4_mul(x, k);
+        y = _input_f4_mul(y, k);
+    }
+    _input_f4_store(out_x, x);
+    _input_f4_store(out_y, y);
+}
+
+static void _input_update_gamepad_axes(sapp_input_context *ctx) {
+    _input_gamepad_axes *g = &ctx->gamepad_axes;
+    if (!g->dirty)
+        return;
+    const _state *s = &_INPUT_CURRENT(ctx);
+    const _input_response *triggers = &g->prepared[SAPP_GAMEPAD_RESPONSE_TRIGGERS];
+    for (int lane = 0; lane < _INPUT_GAMEPAD_LANES; lane += 4) {
+        _input_stick_apply(&g->prepared[SAPP_GAMEPAD_RESPONSE_LEFT_STICK],
+                           s->gamepad_axes[SAPP_GAMEPAD_AXIS_LEFT_X] + lane, s->gamepad_axes[SAPP_GAMEPAD_AXIS_LEFT_Y] + lane,
+                           g->values[SAPP_GAMEPAD_AXIS_LEFT_X] + lane, g->values[SAPP_GAMEPAD_AXIS_LEFT_Y] + lane);
+        _input_stick_apply(&g->prepared[SAPP_GAMEPAD_RESPONSE_RIGHT_STICK],
+                           s->gamepad_axes[SAPP_GAMEPAD_AXIS_RIGHT_X] + lane, s->gamepad_axes[SAPP_GAMEPAD_AXIS_RIGHT_Y] + lane,
+                           g->values[SAPP_GAMEPAD_AXIS_RIGHT_X] + lane, g->values[SAPP_GAMEPAD_AXIS_RIGHT_Y] + lane);
+        for (int axis = SAPP_GAMEPAD_AXIS_LEFT_TRIGGER; axis <= SAPP_GAMEPAD_AXIS_RIGHT_TRIGGER; axis++) {
+            _input_f4 t = _input_f4_max(_input_f4_load(s->gamepad_axes[axis] + lane), _input_f4_set(0.f));
+            _input_f4_store(g->values[axis] + lane, _input_response_apply(triggers, t));
+        }
+    }
+    g->dirty = false;
+    ctx->virtual_axes.dirty = true;
+}
+
+sapp_gamepad_response sapp_ctx_input_gamepad_response(sapp_input_context *ctx, int group) {
+    if ((unsigned)group >= SAPP_GAMEPAD_RESPONSE_COUNT)
+        group = SAPP_GAMEPAD_RESPONSE_LEFT_STICK;
+    return ctx->gamepad_axes.config[group];
+}
+
+void sapp_ctx_input_set_gamepad_response(sapp_input_context *ctx, int group, const sapp_gamepad_response *response) {
+    if ((unsigned)group >= SAPP_GAMEPAD_RESPONSE_COUNT)
+        return;
+    _input_gamepad_axes *g = &ctx->gamepad_axes;
+    _input_response *r = &g->prepared[group];
+    g->config[group] = *response;
+    r->deadzone_mode = response->deadzone_mode;
+    r->curve = response->curve;
+    r->deadzone = _CLAMP(response->deadzone, 0.f, 1.f);
+    r->scale = 1.f / _MAX(response->saturation - r->deadzone, 1e-6f);
+    r->anti_deadzone = _CLAMP(response->anti_deadzone, 0.f, 1.f);
+    r->gain = 1.f - r->anti_deadzone;
+    r->base = response->points[0];
+    for (int i = 0; i < SAPP_GAMEPAD_CURVE_POINTS - 1; i++)
+        r->steps[i] = response->points[i + 1] - response->points[i];
+    g->dirty = true;
+}
+
+void sapp_ctx_input_set_gamepad_backend(sapp_input_context *ctx, const sapp_gamepad_backend *backend) {
+    if (ctx->gamepad_backend.shutdown)
+        ctx->gamepad_backend.shutdown(ctx->gamepad_backend.user_data);
+    if (ctx->gamepad_backend.poll)
+        for (int pad = 0; pad < SOKOL_INPUT_MAX_GAMEPADS; pad++)
+            if (sapp_ctx_gamepad_connected(ctx, pad))
+                sapp_ctx_input_gamepad_connect(ctx, pad, false);
+    if (backend)
+        ctx->gamepad_backend = *backend;
+    else
+        memset(&ctx->gamepad_backend, 0, sizeof(sapp_gamepad_backend));
+}
+
+void sapp_ctx_input_poll_gamepads(sapp_input_context *ctx) {
+    if (ctx->gamepad_backend.poll)
+        ctx->gamepad_backend.poll(ctx, ctx->gamepad_backend.user_data);
+}
+
+static void _input_gamepad_submit(sapp_input_context *ctx, int type, int gamepad, int index, float value) {
+    if ((unsigned)gamepad >= SOKOL_INPUT_MAX_GAMEPADS)
+        return;
+    sapp_input_record r;
+    memset(&r, 0, sizeof(sapp_input_record));
+    r.time = _input_elapsed(ctx);
+    r.type = (uint8_t)type;
+    r.code = (uint16_t)(gamepad << 8 | index);
+    r.x = value;
+    _input_submit(ctx, &r);
+}
+
+void sapp_ctx_input_gamepad_connect(sapp_input_context *ctx, int gamepad, bool connected) {
+    _input_gamepad_submit(ctx, connected ? SAPP_INPUT_RECORD_GAMEPAD_CONNECTED : SAPP_INPUT_RECORD_GAMEPAD_DISCONNECTED, gamepad, 0, 0.f);
+}
+
+void sapp_ctx_input_gamepad_button(sapp_input_context *ctx, int gamepad, int button, bool down) {
+    if ((unsigned)button < 32)
+        _input_gamepad_submit(ctx, down ? SAPP_INPUT_RECORD_GAMEPAD_BUTTON_DOWN : SAPP_INPUT_RECORD_GAMEPAD_BUTTON_UP, gamepad, button, 0.f);
+}
+
+void sapp_ctx_input_gamepad_axis(sapp_input_context *ctx, int gamepad, int axis, float value) {
+    if ((unsigned)axis < SAPP_GAMEPAD_AXIS_COUNT)
+        _input_gamepad_submit(ctx, SAPP_INPUT_RECORD_GAMEPAD_AXIS, gamepad, axis, value);
+}
+
+bool sapp_ctx_gamepad_connected(sapp_input_context *ctx, int gamepad) {
+    return (unsigned)gamepad < SOKOL_INPUT_MAX_GAMEPADS && (_INPUT_CURRENT(ctx).gamepads >> gamepad & 1);
+}
+
+// Bit of the button, or 0 for out of range arguments so every query below reads false
+static inline uint32_t _input_gamepad_bit(int gamepad, int button) {
+    return (unsigned)gamepad < SOKOL_INPUT_MAX_GAMEPADS && (unsigned)button < 32 ? 1u << button : 0;
+}
+
+bool sapp_ctx_is_gamepad_button_down(sapp_input_context *ctx, int gamepad, int button) {
+    uint32_t bit = _input_gamepad_bit(gamepad, button);
+    return bit && (_INPUT_CURRENT(ctx).gamepad_buttons[gamepad] & bit);
+}
+
+bool sapp_ctx_was_gamepad_button_pressed(sapp_input_context *ctx, int gamepad, int button) {
+    uint32_t bit = _input_gamepad_bit(gamepad, button);
+    return bit && (ctx->gamepad_pressed[gamepad] & bit);
+}
+
+bool sapp_ctx_was_gamepad_button_released(sapp_input_context *ctx, int gamepad, int button) {
+    uint32_t bit = _input_gamepad_bit(gamepad, button);
+    return bit && (ctx->gamepad_released[gamepad] & bit);
+}
+
+uint32_t sapp_ctx_gamepad_buttons(sapp_input_context *ctx, int gamepad) {
+    return (unsigned)gamepad < SOKOL_INPUT_MAX_GAMEPADS ? _INPUT_CURRENT(ctx).gamepad_buttons[gamepad] : 0;
+}
+
+float sapp_ctx_gamepad_axis(sapp_input_context *ctx, int gamepad, int axis) {
+    if ((unsigned)gamepad >= SOKOL_INPUT_MAX_GAMEPADS || (unsigned)axis >= SAPP_GAMEPAD_AXIS_COUNT)
+        return 0.f;
+    _input_update_gamepad_axes(ctx);
+    return ctx->gamepad_axes.values[axis][gamepad];
+}
+
+float sapp_ctx_gamepad_axis_raw(sapp_input_context *ctx, int gamepad, int axis) {
+    if ((unsigned)gamepad >= SOKOL_INPUT_MAX_GAMEPADS || (unsigned)axis >= SAPP_GAMEPAD_AXIS_COUNT)
+        return 0.f;
+    return _INPUT_CURRENT(ctx).gamepad_axes[axis][gamepad];
+}
+
+static const struct {
+    uint8_t length;
+    const char *name;
+    uint8_t target;
+} _input_mapping_targets[] = {
+    { 1, "a", SAPP_GAMEPAD_BUTTON_A },
+    { 1, "b", SAPP_GAMEPAD_BUTTON_B },
+    { 1, "x", SAPP_GAMEPAD_BUTTON_X },
+    { 1, "y", SAPP_GAMEPAD_BUTTON_Y },
+    { 4, "back", SAPP_GAMEPAD_BUTTON_BACK },
+    { 5, "guide", SAPP_GAMEPAD_BUTTON_GUIDE },
+    { 5, "start", SAPP_GAMEPAD_BUTTON_START },
+    { 9, "leftstick", SAPP_GAMEPAD_BUTTON_LEFT_STICK },
+    { 10, "rightstick", SAPP_GAMEPAD_BUTTON_RIGHT_STICK },
+    { 12, "leftshoulder", SAPP_GAMEPAD_BUTTON_LEFT_SHOULDER },
+    { 13, "rightshoulder", SAPP_GAMEPAD_BUTTON_RIGHT_SHOULDER },
+    { 4, "dpup", SAPP_GAMEPAD_BUTTON_DPAD_UP },
+    { 6, "dpdown", SAPP_GAMEPAD_BUTTON_DPAD_DOWN },
+    { 6, "dpleft", SAPP_GAMEPAD_BUTTON_DPAD_LEFT },
+    { 7, "dpright", SAPP_GAMEPAD_BUTTON_DPAD_RIGHT },
+    { 5, "leftx", _INPUT_MAPPING_AXIS | SAPP_GAMEPAD_AXIS_LEFT_X },
+    { 5, "lefty", _INPUT_MAPPING_AXIS | SAPP_GAMEPAD_AXIS_LEFT_Y },
+    { 6, "rightx", _INPUT_MAPPING_AXIS | SAPP_GAMEPAD_AXIS_RIGHT_X },
+    { 6, "righty", _INPUT_MAPPING_AXIS | SAPP_GAMEPAD_AXIS_RIGHT_Y },
+    { 11, "lefttrigger", _INPUT_MAPPING_AXIS | SAPP_GAMEPAD_AXIS_LEFT_TRIGGER },
+    { 12, "righttrigger", _INPUT_MAPPING_AXIS | SAPP_GAMEPAD_AXIS_RIGHT_TRIGGER }
+};
+
+// Perfect hash of the target names, (length * 2 + last + first * 5) & 63, to their index in the table above + 1
+static const uint8_t _input_mapping_target_hash[64] = {
+    0, 0, 0, 0, 21, 0, 11, 0, 1, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 3, 0, 0, 0, 0, 0, 4, 8, 0, 0, 0, 5, 16, 17,
+    0, 0, 0, 0, 20, 0, 10, 0, 0, 0, 0, 0, 12, 0, 13, 0,
+    0, 0, 6, 0, 14, 0, 15, 0, 0, 9, 0, 0, 0, 7, 18, 19
+};
+
+// The platform field value of mappings for this build, NULL to accept every mapping
+static const char* _input_mapping_platform(void) {
+#if defined(_WIN32)
+    return "Windows";
+#elif defined(__APPLE__)
+    return "Mac OS X";
+#elif defined(__ANDROID__)
+    return "Android";
+#elif defined(__linux__)
+    return "Linux";
+#else
+    return NULL;
+#endif
+}
+
+static inline int _input_hex(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static bool _input_parse_guid(const char *text, uint8_t *guid) {
+    for (int i = 0; i < 16; i++) {
+        int hi = _input_hex(text[i * 2]), lo = hi < 0 ? -1 : _input_hex(text[i * 2 + 1]);
+        if (lo < 0)
+            return false;
+        guid[i] = (uint8_t)(hi << 4 | lo);
+    }
+    // Bytes 2-3 hold a CRC of the device name in newer databases, devices are matched without it
+    guid[2] = guid[3] = 0;
+    return true;
+}
+
+static inline uint32_t _input_mapping_hash(const uint8_t *guid) {
+    uint64_t a, b;
+    memcpy(&a, guid, 8);
+    memcpy(&b, guid + 8, 8);
+    return (uint32_t)(((a ^ (b * 0x9E3779B97F4A7C15ull)) * 0xC2B2AE3D27D4EB4Full) >> 32);
+}
+
+// The slot of the GUID, or the empty slot where it would go
+static _input_mapping* _input_mapping_slot(const _input_mappings *m, const uint8_t *guid) {
+    uint32_t mask = (uint32_t)m->capacity - 1;
+    for (uint32_t i = _input_mapping_hash(guid) & mask;; i = (i + 1) & mask)
+        if (!m->slots[i].used || !memcmp(m->slots[i].guid, guid, 16))
+            return &m->slots[i];
+}
+
+static const _input_mapping* _input_mapping_find(const _input_mappings *m, const uint8_t *guid) {
+    if (!m->count)
+        return NULL;
+    const _input_mapping *slot = _input_mapping_slot(m, guid);
+    return slot->used ? slot : NULL;
+}
+
+// Grows both arrays by doubling, so loading a database allocates a handful of times
+static bool _input_mappings_reserve(_input_mappings *m, size_t mappings, size_t bindings) {
+    if (m->binding_count + bindings > m->binding_capacity) {
+        size_t capacity = _MAX(m->binding_count + bindings, (size_t)m->binding_capacity * 2);
+        _input_mapping_binding *grown = (_input_mapping_binding*)SOKOL_INPUT_MALLOC(sizeof(_input_mapping_binding) * capacity);
+        if (!grown)
+            return false;
+        if (m->bindings) {
+            memcpy(grown, m->bindings, sizeof(_input_mapping_binding) * m->binding_count);
+            SOKOL_INPUT_FREE(m->bindings);
+        }
+        m->bindings = grown;
+        m->binding_capacity = (uint32_t)capacity;
+    }
+    size_t needed = (m->count + mappings) * 2;
+    if (needed > (size_t)m->capacity) {
+        int capacity = 16;
+        while ((size_t)capacity < needed)
+            capacity *= 2;
+        _input_mapping *slots = (_input_mapping*)SOKOL_INPUT_MALLOC(sizeof(_input_mapping) * (size_t)capacity);
+        if (!slots)
+            return false;
+        memset(slots, 0, sizeof(_input_mapping) * (size_t)capacity);
+        _input_mappings grown = *m;
+        grown.slots = slots;
+        grown.capacity = capacity;
+        for (int i = 0; i < m->capacity; i++)
+            if (m->slots[i].used)
+                *_input_mapping_slot(&grown, m->slots[i].guid) = m->slots[i];
+        if (m->slots)
+            SOKOL_INPUT_FREE(m->slots);
+        m->slots = slots;
+        m->capacity = capacity;
+    }
+    return true;
+}
+
+static const char* _input_parse_index(const char *p, const char *end, int *out) {
+    int v = 0;
+    const char *start = p;
+    while (p < end && *p >= '0' && *p <= '9' && v < 256)
+        v = v * 10 + (*p++ - '0');
+    *out = v;
+    return p > start && v < 256 ? p : NULL;
+}
+
+// One "target:source" field, anything unrecognized is skipped. Clears *platform_ok for another platform's mapping.
+static void _input_mapping_field(_input_mappings *m, const char *key, const char *colon, const char *end, bool *platform_ok) {
+    const char *v = colon + 1;
+    if (colon - key == 8 && !memcmp(key, "platform", 8)) {
+        const char *platform = _input_mapping_platform();
+        *platform_ok = !platform || (strlen(platform) == (size_t)(end - v) && !memcmp(platform, v, (size_t)(end - v)));
+        return;
+    }
+    _input_mapping_binding b;
+    memset(&b, 0, sizeof(_input_mapping_binding));
+    if (*key == '+' || *key == '-')
+        b.half = *key++ == '+' ? 1 : -1;
+    int length = (int)(colon - key);
+    if (length < 1)
+        return;
+    int target = _input_mapping_target_hash[(length * 2 + key[length - 1] + key[0] * 5) & 63] - 1;
+    if (target < 0 || _input_mapping_targets[target].length != length || memcmp(_input_mapping_targets[target].name, key, (size_t)length))
+        return;
+    b.target = _input_mapping_targets[target].target;
+    if (!(b.target & _INPUT_MAPPING_AXIS))
+        b.half = 0;
+    if (v < end && (*v == '+' || *v == '-'))
+        b.detail |= *v++ == '+' ? _INPUT_MAPPING_HIGH : _INPUT_MAPPING_LOW;
+    if (v >= end || (*v != 'b' && *v != 'a' && *v != 'h'))
+        return;
+    b.source = (uint8_t)*v++;
+    int index, mask;
+    if (!(v = _input_parse_index(v, end, &index)))
+        return;
+    b.index = (uint8_t)index;
+    if (b.source == 'h') {
+        if (v >= end || *v != '.' || !_input_parse_index(v + 1, end, &mask))
+            return;
+        b.detail = (uint8_t)mask;
+    } else if (b.source == 'a' && v < end && *v == '~')
+        b.detail |= _INPUT_MAPPING_INVERT;
+    m->bindings[m->binding_count++] = b;
+}
+
+int sapp_ctx_input_add_gamepad_mappings(sapp_input_context *ctx, const char *mappings, size_t length) {
+    _input_mappings *m = &ctx->mappings;
+    if (!length)
+        length = strlen(mappings);
+    int added = 0;
+    const char *p = mappings, *end = mappings + length;
+    while (p < end) {
+        const char *line = p, *eol = (const char*)memchr(p, '\n', (size_t)(end - p));
+        if (!eol)
+            eol = end;
+        p = eol + 1;
+        if (eol > line && eol[-1] == '\r')
+            eol--;
+        while (line < eol && (*line == ' ' || *line == '\t'))
+            line++;
+        uint8_t guid[16];
+        // Comments and blank lines fail here too
+        if (eol - line < 33 || line[32] != ',' || !_input_parse_guid(line, guid))
+            continue;
+        // Every binding takes at least "a:b0,", reserving for the worst case keeps the field parser allocation free
+        if (!_input_mappings_reserve(m, 1, (size_t)(eol - line) / 5 + 1))
+            return -1;
+        const char *field = (const char*)memchr(line + 33, ',', (size_t)(eol - line - 33));
+        if (!field)
+            continue;
+        uint32_t first = m->binding_count;
+        bool platform_ok = true;
+        for (field++; field < eol;) {
+            const char *next = field, *colon = NULL;
+            for (; next < eol && *next != ','; next++)
+                if (*next == ':' && !colon)
+                    colon = next;
+            if (colon)
+                _input_mapping_field(m, field, colon, next, &platform_ok);
+            field = next + 1;
+        }
+        if (!platform_ok || m->binding_count - first > 255) {
+            m->binding_count = first;
+            continue;
+        }
+        _input_mapping *slot = _input_mapping_slot(m, guid);
+        if (!slot->used) {
+            memcpy(slot->guid, guid, 16);
+            slot->used = true;
+            m->count++;
+        }
+        slot->first = first;
+        slot->count = (uint8_t)(m->binding_count - first);
+        added++;
+    }
+    return added;
+}
+
+void sapp_ctx_input_clear_gamepad_mappings(sapp_input_context *ctx) {
+    if (ctx->mappings.slots)
+        SOKOL_INPUT_FREE(ctx->mappings.slots);
+    if (ctx->mappings.bindings)
+        SOKOL_INPUT_FREE(ctx->mappings.bindings);
+    memset(&ctx->mappings, 0, sizeof(_input_mappings));
+}
+
+bool sapp_ctx_input_has_gamepad_mapping(sapp_input_context *ctx, const char *guid) {
+    uint8_t key[16];
+    return strlen(guid) >= 32 && _input_parse_guid(guid, key) && _input_mapping_find(&ctx->mappings, key);
+}
+
+#if defined(_INPUT_EVDEV)
+// Gamepad buttons live in BTN_MISC..KEY_MAX, everything below is keyboard keys
+#define _INPUT_EVDEV_KEY_BASE BTN_MISC
+#define _INPUT_EVDEV_KEYS     (KEY_MAX + 1 - BTN_MISC)
+#define _INPUT_EVDEV_BATCH    64
+#define _INPUT_EVDEV_PATH     256
+#define _INPUT_EVDEV_LONG_BITS (8 * (int)sizeof(unsigned long))
+
+// Where an evdev key or absolute axis is routed
+enum {
+    _INPUT_EVDEV_UNMAPPED,
+    _INPUT_EVDEV_BUTTON,
+    _INPUT_EVDEV_AXIS
+};
+
+typedef struct {
+    uint8_t kind, index;
+    // Axis targets: 1 or -1 to drive only that half of the axis
+    int8_t half;
+    // Axis sources: 1 or -1 to read only the upper or lower half of the range, inverted first if `invert`
+    int8_t input;
+    bool invert;
+} _input_evdev_target;
+
+// An axis can feed two targets, e.g. the two directions of a hat
+typedef struct {
+    _input_evdev_target out[2];
+    int32_t min, max;
+} _input_evdev_abs;
+
+// Devices sit in the slot of their gamepad, fd is -1 for free slots
+typedef struct {
+    int fd;
+    // Set by SYN_DROPPED, events are skipped until the next SYN_REPORT and the state is read back
+    bool dropped;
+    char path[_INPUT_EVDEV_PATH];
+    _input_evdev_target keys[_INPUT_EVDEV_KEYS];
+    _input_evdev_abs abs[ABS_CNT];
+} _input_evdev_device;
+
+typedef struct {
+    int notify;
+    char directory[_INPUT_EVDEV_PATH];
+    _input_evdev_device devices[SOKOL_INPUT_MAX_GAMEPADS];
+} _input_evdev;
+
+static void _input_evdev_key(_input_evdev_device *dev, int code, uint8_t kind, int index) {
+    dev->keys[code - _INPUT_EVDEV_KEY_BASE].kind = kind;
+    dev->keys[code - _INPUT_EVDEV_KEY_BASE].index = (uint8_t)index;
+}
+
+static void _input_evdev_abs_map(_input_evdev_device *dev, int code, uint8_t kind, int index, int input, int32_t min, int32_t max) {
+    _input_evdev_target *t = &dev->abs[code].out[dev->abs[code].out[0].kind != _INPUT_EVDEV_UNMAPPED];
+    t->kind = kind;
+    t->index = (uint8_t)index;
+    t->input = (int8_t)input;
+    dev->abs[code].min = min;
+    dev->abs[code].max = max;
+}
+
+// The layout of the Linux gamepad specification, with xpad ranges for devices that can't report their own
+static void _input_evdev_default_map(_input_evdev_device *dev) {
+    memset(dev->keys, 0, sizeof(dev->keys));
+    memset(dev->abs, 0, sizeof(dev->abs));
+    _input_evdev_key(dev, BTN_SOUTH, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_A);
+    _input_evdev_key(dev, BTN_EAST, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_B);
+    _input_evdev_key(dev, BTN_WEST, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_X);
+    _input_evdev_key(dev, BTN_NORTH, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_Y);
+    _input_evdev_key(dev, BTN_SELECT, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_BACK);
+    _input_evdev_key(dev, BTN_MODE, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_GUIDE);
+    _input_evdev_key(dev, BTN_START, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_START);
+    _input_evdev_key(dev, BTN_THUMBL, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_LEFT_STICK);
+    _input_evdev_key(dev, BTN_THUMBR, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_RIGHT_STICK);
+    _input_evdev_key(dev, BTN_TL, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_LEFT_SHOULDER);
+    _input_evdev_key(dev, BTN_TR, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_RIGHT_SHOULDER);
+    _input_evdev_key(dev, BTN_DPAD_UP, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_UP);
+    _input_evdev_key(dev, BTN_DPAD_DOWN, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_DOWN);
+    _input_evdev_key(dev, BTN_DPAD_LEFT, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_LEFT);
+    _input_evdev_key(dev, BTN_DPAD_RIGHT, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_RIGHT);
+    // Digital triggers
+    _input_evdev_key(dev, BTN_TL2, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_LEFT_TRIGGER);
+    _input_evdev_key(dev, BTN_TR2, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_RIGHT_TRIGGER);
+    _input_evdev_abs_map(dev, ABS_X, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_LEFT_X, 0, -32768, 32767);
+    _input_evdev_abs_map(dev, ABS_Y, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_LEFT_Y, 0, -32768, 32767);
+    _input_evdev_abs_map(dev, ABS_RX, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_RIGHT_X, 0, -32768, 32767);
+    _input_evdev_abs_map(dev, ABS_RY, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_RIGHT_Y, 0, -32768, 32767);
+    _input_evdev_abs_map(dev, ABS_Z, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_LEFT_TRIGGER, 0, 0, 255);
+    _input_evdev_abs_map(dev, ABS_RZ, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_RIGHT_TRIGGER, 0, 0, 255);
+    _input_evdev_abs_map(dev, ABS_BRAKE, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_LEFT_TRIGGER, 0, 0, 255);
+    _input_evdev_abs_map(dev, ABS_GAS, _INPUT_EVDEV_AXIS, SAPP_GAMEPAD_AXIS_RIGHT_TRIGGER, 0, 0, 255);
+    _input_evdev_abs_map(dev, ABS_HAT0X, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_LEFT, -1, -1, 1);
+    _input_evdev_abs_map(dev, ABS_HAT0X, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_RIGHT, 1, -1, 1);
+    _input_evdev_abs_map(dev, ABS_HAT0Y, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_UP, -1, -1, 1);
+    _input_evdev_abs_map(dev, ABS_HAT0Y, _INPUT_EVDEV_BUTTON, SAPP_GAMEPAD_BUTTON_DPAD_DOWN, 1, -1, 1);
+}
+
+// u is the source scaled to 0..1. Keys rest at 0, axis sources at the center of full axis targets.
+static void _input_evdev_emit(sapp_input_context *ctx, int pad, const _input_evdev_target *t, float u, bool key) {
+    if (t->kind == _INPUT_EVDEV_BUTTON)
+        sapp_ctx_input_gamepad_button(ctx, pad, t->index, u > .5f);
+    else if (t->kind == _INPUT_EVDEV_AXIS) {
+        if (t->half)
+            u *= (float)t->half;
+        else if (!key && t->index < SAPP_GAMEPAD_AXIS_LEFT_TRIGGER)
+            u = u * 2.f - 1.f;
+        sapp_ctx_input_gamepad_axis(ctx, pad, t->index, u);
+    }
+}
+
+static void _input_evdev_abs_event(sapp_input_context *ctx, int pad, const _input_evdev_abs *a, int32_t value) {
+    float t = a->max > a->min ? (float)((double)value - a->min) / (float)((double)a->max - a->min) : 0.f;
+    t = _CLAMP(t, 0.f, 1.f);
+    for (int i = 0; i < 2; i++) {
+        const _input_evdev_target *o = &a->out[i];
+        float u = o->invert ? 1.f - t : t;
+        if (o->input)
+            u = o->input > 0 ? _MAX(u * 2.f - 1.f, 0.f) : _MAX(1.f - u * 2.f, 0.f);
+        _input_evdev_emit(ctx, pad, o, u, false);
+    }
+}
+
+// Reads the ranges and the current state of a device, does nothing for files that aren't devices
+static void _input_evdev_sync(sapp_input_context *ctx, _input_evdev_device *dev, int pad) {
+    unsigned long keys[(KEY_MAX + 1 + _INPUT_EVDEV_LONG_BITS - 1) / _INPUT_EVDEV_LONG_BITS];
+    if (ioctl(dev->fd, EVIOCGKEY(sizeof(keys)), keys) >= 0)
+        for (int code = _INPUT_EVDEV_KEY_BASE; code <= KEY_MAX; code++)
+            if (dev->keys[code - _INPUT_EVDEV_KEY_BASE].kind != _INPUT_EVDEV_UNMAPPED)
+                _input_evdev_emit(ctx, pad, &dev->keys[code - _INPUT_EVDEV_KEY_BASE],
+                                  (float)((keys[code / _INPUT_EVDEV_LONG_BITS] >> (code % _INPUT_EVDEV_LONG_BITS)) & 1), true);
+    for (int code = 0; code < ABS_CNT; code++) {
+        struct input_absinfo info;
+        if (dev->abs[code].out[0].kind == _INPUT_EVDEV_UNMAPPED || ioctl(dev->fd, EVIOCGABS(code), &info) < 0)
+            continue;
+        if (info.maximum > info.minimum) {
+            dev->abs[code].min = info.minimum;
+            dev->abs[code].max = info.maximum;
+        }
+        _input_evdev_abs_event(ctx, pad, &dev->abs[code], info.value);
+    }
+}
+
+static inline bool _input_evdev_bit(const unsigned long *bits, int bit) {
+    return (bits[bit / _INPUT_EVDEV_LONG_BITS] >> (bit % _INPUT_EVDEV_LONG_BITS)) & 1;
+}
+
+// Routes the device through a loaded mapping, numbering its buttons, axes and hats the way SDL does:
+// buttons from BTN_JOYSTICK up then the codes below it, axes in code order without the hats
+static bool _input_evdev_apply_mapping(sapp_input_context *ctx, _input_evdev_device *dev) {
+    struct input_id id;
+    if (!ctx->mappings.count || ioctl(dev->fd, EVIOCGID, &id) < 0 || !id.vendor || !id.product)
+        return false;
+    uint8_t guid[16] = { 0 };
+    guid[0] = (uint8_t)id.bustype;
+    guid[1] = (uint8_t)(id.bustype >> 8);
+    guid[4] = (uint8_t)id.vendor;
+    guid[5] = (uint8_t)(id.vendor >> 8);
+    guid[8] = (uint8_t)id.product;
+    guid[9] = (uint8_t)(id.product >> 8);
+    guid[12] = (uint8_t)id.version;
+    guid[13] = (uint8_t)(id.version >> 8);
+    const _input_mapping *map = _input_mapping_find(&ctx->mappings, guid);
+    if (!map) {
+        guid[12] = guid[13] = 0;
+        map = _input_mapping_find(&ctx->mappings, guid);
+    }
+    unsigned long keys[(KEY_MAX + 1 + _INPUT_EVDEV_LONG_BITS - 1) / _INPUT_EVDEV_LONG_BITS];
+    unsigned long abs[(ABS_CNT + _INPUT_EVDEV_LONG_BITS - 1) / _INPUT_EVDEV_LONG_BITS];
+    if (!map || ioctl(dev->fd, EVIOCGBIT(EV_KEY, sizeof(keys)), keys) < 0 || ioctl(dev->fd, EVIOCGBIT(EV_ABS, sizeof(abs)), abs) < 0)
+        return false;
+    uint16_t buttons[256];
+    uint8_t axes[ABS_CNT], hats[4];
+    int button_count = 0, axis_count = 0, hat_count = 0;
+    for (int code = BTN_JOYSTICK; code < KEY_MAX && button_count < 256; code++)
+        if (_input_evdev_bit(keys, code))
+            buttons[button_count++] = (uint16_t)code;
+    for (int code = 0; code < BTN_JOYSTICK && button_count < 256; code++)
+        if (_input_evdev_bit(keys, code))
+            buttons[button_count++] = (uint16_t)code;
+    for (int code = 0; code < ABS_MAX; code++)
+        if ((code < ABS_HAT0X || code > ABS_HAT3Y) && _input_evdev_bit(abs, code))
+            axes[axis_count++] = (uint8_t)code;
+    for (int code = ABS_HAT0X; code <= ABS_HAT3Y; code += 2)
+        if (_input_evdev_bit(abs, code) || _input_evdev_bit(abs, code + 1))
+            hats[hat_count++] = (uint8_t)code;
+    memset(dev->keys, 0, sizeof(dev->keys));
+    for (int code = 0; code < ABS_CNT; code++)
+        memset(dev->abs[code].out, 0, sizeof(dev->abs[code].out));
+    for (int i = 0; i < map->count; i++) {
+        const _input_mapping_binding *b = &ctx->mappings.bindings[map->first + i];
+        _input_evdev_target t;
+        memset(&t, 0, sizeof(_input_evdev_target));
+        t.kind = (b->target & _INPUT_MAPPING_AXIS) ? _INPUT_EVDEV_AXIS : _INPUT_EVDEV_BUTTON;
+        t.index = b->target & ~_INPUT_MAPPING_AXIS;
+        t.half = b->half;
+        int code = -1;
+        if (b->source == 'b' && b->index < button_count && buttons[b->index] >= _INPUT_EVDEV_KEY_BASE)
+            dev->keys[buttons[b->index] - _INPUT_EVDEV_KEY_BASE] = t;
+        else if (b->source == 'a' && b->index < axis_count) {
+            code = axes[b->index];
+            t.invert = (b->detail & _INPUT_MAPPING_INVERT) != 0;
+            t.input = (b->detail & _INPUT_MAPPING_HIGH) ? 1 : (b->detail & _INPUT_MAPPING_LOW) ? -1 : 0;
+        } else if (b->source == 'h' && b->index < hat_count) {
+            // Mask bits: 1 up, 2 right, 4 down, 8 left
+            code = hats[b->index] + ((b->detail & 5) ? 1 : 0);
+            t.input = (b->detail & 9) ? -1 : 1;
+        }
+        if (code >= 0 && dev->abs[code].out[1].kind == _INPUT_EVDEV_UNMAPPED)
+            dev->abs[code].out[dev->abs[code].out[0].kind != _INPUT_EVDEV_UNMAPPED] = t;
+    }
+    return true;
+}
+
+static bool _input_evdev_is_gamepad(int fd) {
+    unsigned long keys[(KEY_MAX + 1 + _INPUT_EVDEV_LONG_BITS - 1) / _INPUT_EVDEV_LONG_BITS];
+    if (ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keys)), keys) < 0)
+        return errno == ENOTTY || errno == EINVAL;
+    return ((keys[BTN_GAMEPAD / _INPUT_EVDEV_LONG_BITS] >> (BTN_GAMEPAD % _INPUT_EVDEV_LONG_BITS)) & 1) ||
+           ((keys[BTN_JOYSTICK / _INPUT_EVDEV_LONG_BITS] >> (BTN_JOYSTICK % _INPUT_EVDEV_LONG_BITS)) & 1);
+}
+
+static int _input_evdev_open(sapp_input_context *ctx, _input_evdev *ev, const char *path, bool check) {
+    size_t length = strlen(path);
+    if (length >= _INPUT_EVDEV_PATH)
+        return -1;
+    int pad = -1;
+    for (int i = SOKOL_INPUT_MAX_GAMEPADS - 1; i >= 0; i--) {
+        if (ev->devices[i].fd < 0)
+            pad = i;
+        else if (!strcmp(ev->devices[i].path, path))
+            return i;
+    }
+    if (pad < 0)
+        return -1;
+    _input_evdev_device *dev = &ev->devices[pad];
+#if defined(O_CLOEXEC)
+    int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+#else
+    // Strict ISO mode hides O_CLOEXEC
+    int fd = open(path, O_RDONLY | O_NONBLOCK);
+    if (fd >= 0)
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+    if (fd < 0)
+        return -1;
+    if (check && !_input_evdev_is_gamepad(fd)) {
+        close(fd);
+        return -1;
+    }
+    dev->fd = fd;
+    dev->dropped = false;
+    memcpy(dev->path, path, length + 1);
+    _input_evdev_default_map(dev);
+    _input_evdev_apply_mapping(ctx, dev);
+    sapp_ctx_input_gamepad_connect(ctx, pad, true);
+    _input_evdev_sync(ctx, dev, pad);
+    return pad;
+}
+
+static void _input_evdev_close(sapp_input_context *ctx, _input_evdev *ev, int pad) {
+    close(ev->devices[pad].fd);
+    ev->devices[pad].fd = -1;
+    if (ctx)
+        sapp_ctx_input_gamepad_connect(ctx, pad, false);
+}
+
+static void _input_evdev_hotplug(sapp_input_context *ctx, _input_evdev *ev) {
+    union {
+        struct inotify_event event;
+        char bytes[4096];
+    } buffer;
+    ssize_t n;
+    while ((n = read(ev->notify, buffer.bytes, sizeof(buffer.bytes))) > 0) {
+        for (ssize_t at = 0; at + (ssize_t)sizeof(struct inotify_event) <= n;) {
+            const struct inotify_event *e = (const struct inotify_event*)(buffer.bytes + at);
+            at += (ssize_t)sizeof(struct inotify_event) + e->len;
+            char path[_INPUT_EVDEV_PATH];
+            if (!e->len || strncmp(e->name, "event", 5))
+                continue;
+            size_t dir = strlen(ev->directory), name = strlen(e->name);
+            if (dir + 1 + name >= sizeof(path))
+                continue;
+            memcpy(path, ev->directory, dir);
+            path[dir] = '/';
+            memcpy(path + dir + 1, e->name, name + 1);
+            // Device nodes appear before udev grants access to them, so IN_ATTRIB retries the open
+            if (e->mask & (IN_CREATE | IN_ATTRIB))
+                _input_evdev_open(ctx, ev, path, true);
+            else if (e->mask & IN_DELETE)
+                for (int i = 0; i < SOKOL_INPUT_MAX_GAMEPADS; i++)
+                    if (ev->devices[i].fd >= 0 && !strcmp(ev->devices[i].path, path))
+                        _input_evdev_close(ctx, ev, i);
+        }
+    }
+}
+
+static void _input_evdev_poll(sapp_input_context *ctx, void *user_data) {
+    _input_evdev *ev = (_input_evdev*)user_data;
+    if (ev->notify >= 0)
+        _input_evdev_hotplug(ctx, ev);
+    for (int pad = 0; pad < SOKOL_INPUT_MAX_GAMEPADS; pad++) {
+        _input_evdev_device *dev = &ev->devices[pad];
+        struct input_event batch[_INPUT_EVDEV_BATCH];
+        ssize_t n = sizeof(batch);
+        while (dev->fd >= 0 && n == (ssize_t)sizeof(batch)) {
+            if ((n = read(dev->fd, batch, sizeof(batch))) < 0) {
+                if (errno == ENODEV)
+                    _input_evdev_close(ctx, ev, pad);
+                break;
+            }
+            for (int i = 0; i < (int)(n / (ssize_t)sizeof(struct input_event)); i++) {
+                const struct input_event *e = &batch[i];
+                if (e->type == EV_SYN) {
+                    if (e->code == SYN_DROPPED)
+                        dev->dropped = true;
+                    else if (e->code == SYN_REPORT && dev->dropped) {
+                        dev->dropped = false;
+                        _input_evdev_sync(ctx, dev, pad);
+                    }
+                } else if (dev->dropped)
+                    continue;
+                else if (e->type == EV_KEY && e->code >= _INPUT_EVDEV_KEY_BASE && e->code <= KEY_MAX)
+                    _input_evdev_emit(ctx, pad, &dev->keys[e->code - _INPUT_EVDEV_KEY_BASE], e->value ? 1.f : 0.f, true);
+                else if (e->type == EV_ABS && e->code < ABS_CNT)
+                    _input_evdev_abs_event(ctx, pad, &dev->abs[e->code], e->value);
+            }
+        }
+    }
+}
+
+static void _input_evdev_shutdown(void *user_data) {
+    _input_evdev *ev = (_input_evdev*)user_data;
+    for (int i = 0; i < SOKOL_INPUT_MAX_GAMEPADS; i++)
+        if (ev->devices[i].fd >= 0)
+            _input_evdev_close(NULL, ev, i);
+    if (ev->notify >= 0)
+        close(ev->notify);
+    SOKOL_INPUT_FREE(ev);
+}
+
+// The evdev state of the context, installing the backend first if another one (or none) is active
+static _input_evdev* _input_evdev_backend(sapp_input_context *ctx) {
+    if (ctx->gamepad_backend.poll == _input_evdev_poll)
+        return (_input_evdev*)ctx->gamepad_backend.user_data;
+    _input_evdev *ev = (_input_evdev*)SOKOL_INPUT_MALLOC(sizeof(_input_evdev));
+    if (!ev)
+        return NULL;
+    memset(ev, 0, sizeof(_input_evdev));
+    ev->notify = -1;
+    for (int i = 0; i < SOKOL_INPUT_MAX_GAMEPADS; i++)
+        ev->devices[i].fd = -1;
+    sapp_gamepad_backend backend;
+    backend.poll = _input_evdev_poll;
+    backend.shutdown = _input_evdev_shutdown;
+    backend.user_data = ev;
+    sapp_ctx_input_set_gamepad_backend(ctx, &backend);
+    return ev;
+}
+
+bool sapp_ctx_input_open_evdev(sapp_input_context *ctx, const char *directory) {
+    if (!directory)
+        directory = "/dev/input";
+    size_t length = strlen(directory);
+    _input_evdev *ev;
+    if (length >= _INPUT_EVDEV_PATH || !(ev = _input_evdev_backend(ctx)))
+        return false;
+    DIR *dir = opendir(directory);
+    if (!dir)
+        return false;
+    memcpy(ev->directory, directory, length + 1);
+    if (ev->notify >= 0)
+        close(ev->notify);
+    // Watch before scanning so a device plugged in during the scan isn't missed
+    if ((ev->notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) >= 0 &&
+        inotify_add_watch(ev->notify, directory, IN_CREATE | IN_ATTRIB | IN_DELETE) < 0) {
+        close(ev->notify);
+        ev->notify = -1;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir))) {
+        char path[_INPUT_EVDEV_PATH];
+        size_t name = strlen(entry->d_name);
+        if (strncmp(entry->d_name, "event", 5) || length + 1 + name >= sizeof(path))
+            continue;
+        memcpy(path, directory, length);
+        path[length] = '/';
+        memcpy(path + length + 1, entry->d_name, name + 1);
+        _input_evdev_open(ctx, ev, path, true);
+    }
+    closedir(dir);
+    return true;
+}
+
+int sapp_ctx_input_evdev_add_device(sapp_input_context *ctx, const char *path) {
+    _input_evdev *ev = _input_evdev_backend(ctx);
+    return ev ? _input_evdev_open(ctx, ev, path, false) : -1;
+}
+#endif
+
+sapp_input_context* sapp_input_create_context(void) {
+    sapp_input_context *ctx = (sapp_input_context*)SOKOL_INPUT_MALLOC(sizeof(sapp_input_context));
+    if (ctx) {
+        memset(ctx, 0, sizeof(sapp_input_context));
+        sapp_ctx_input_init(ctx);
+    }
+    return ctx;
+}
+
+void sapp_input_destroy_context(sapp_input_context *ctx) {
+    if (ctx && ctx != &_input_state) {
+        sapp_ctx_input_stop_recording(ctx);
+        sapp_ctx_input_set_gamepad_backend(ctx, NULL);
+        sapp_ctx_input_clear_gamepad_mappings(ctx);
+        SOKOL_INPUT_FREE(ctx);
+    }
+}
+
+sapp_input_context* sapp_input_default_context(void) {
+    return &_input_state;
+}
+
+void sapp_input_init(void) {
+    sapp_ctx_input_init(&_input_state);
+}
+
+void sapp_input_event(const sapp_event* e) {
+    sapp_ctx_input_event(&_input_state, e);
+}
+
+void sapp_input_flush(void) {
+    sapp_ctx_input_flush(&_input_state);
+}
+
+bool sapp_is_key_down(int key) {
+    return sapp_ctx_is_key_down(&_input_state, key);
+}
+
+bool sapp_was_key_pressed(int key) {
+    return sapp_ctx_was_key_pressed(&_input_state, key);
+}
+
+bool sapp_was_key_released(int key) {
+    return sapp_ctx_was_key_released(&_input_state, key);
+}
+
+int sapp_key_press_count(int key) {
+    return sapp_ctx_key_press_count(&_input_state, key);
+}
 
 bool sapp_are_keys_down(int n, ...) {
     va_list args;
     va_start(args, n);
-    int result = 1;
-    for (int i = 0; i < n; i++)
-        if (!_input_state.input_current.keys[va_arg(args, int)]) {
-            result = 0;
-            goto BAIL;
-        }
-BAIL:
+    bool result = _input_keys_down(&_input_state, n, args, true);
     va_end(args);
     return result;
 }
@@ -300,39 +5651,31 @@ BAIL:
 bool sapp_any_keys_down(int n, ...) {
     va_list args;
     va_start(args, n);
-    int result = 0;
-    for (int i = 0; i < n; i++)
-        if (_input_state.input_current.keys[va_arg(args, int)]) {
-            result = 1;
-            goto BAIL;
-        }
-BAIL:
+    bool result = _input_keys_down(&_input_state, n, args, false);
     va_end(args);
     return result;
 }
 
 bool sapp_is_button_down(int button) {
-    return _input_state.input_current.buttons[button];
+    return sapp_ctx_is_button_down(&_input_state, button);
 }
 
 bool sapp_was_button_pressed(int button) {
-    return sapp_is_button_down(button) && !_input_state.input_prev.buttons[button];
+    return sapp_ctx_was_button_pressed(&_input_state, button);
 }
 
 bool sapp_was_button_released(int button) {
-    return !sapp_is_button_down(button) && _input_state.input_prev.buttons[button];
+    return sapp_ctx_was_button_released(&_input_state, button);
+}
+
+int sapp_button_press_count(int button) {
+    return sapp_ctx_button_press_count(&_input_state, button);
 }
 
 bool sapp_are_buttons_down(int n, ...) {
     va_list args;
     va_start(args, n);
-    int result = 1;
-    for (int i = 0; i < n; i++)
-        if (!_input_state.input_current.buttons[va_arg(args, int)]) {
-            result = 0;
-            goto BAIL;
-        }
-BAIL:
+    bool result = _input_buttons_down(&_input_state, n, args, true);
     va_end(args);
     return result;
 }
@@ -340,54 +5683,394 @@ BAIL:
 bool sapp_any_buttons_down(int n, ...) {
     va_list args;
     va_start(args, n);
-    int result = 0;
-    for (int i = 0; i < n; i++)
-        if (_input_state.input_current.buttons[va_arg(args, int)]) {
-            result = 1;
-            goto BAIL;
-        }
-BAIL:
+    bool result = _input_buttons_down(&_input_state, n, args, false);
     va_end(args);
     return result;
 }
 
 bool sapp_modifier_equals(int mods) {
-    return _input_state.input_current.modifier == mods;
+    return sapp_ctx_modifier_equals(&_input_state, mods);
 }
 
 bool sapp_modifier_down(int mod) {
-    return _input_state.input_current.modifier & mod;
+    return sapp_ctx_modifier_down(&_input_state, mod);
 }
 
 bool sapp_has_mouse_move(void) {
-    return _input_state.input_current.cursor.x != _input_state.input_prev.cursor.x || _input_state.input_current.cursor.y != _input_state.input_prev.cursor.y;
+    return sapp_ctx_has_mouse_move(&_input_state);
 }
 
 int sapp_cursor_x(void) {
-    return _input_state.input_current.cursor.x;
+    return sapp_ctx_cursor_x(&_input_state);
 }
 
 int sapp_cursor_y(void) {
-    return _input_state.input_current.cursor.y;
+    return sapp_ctx_cursor_y(&_input_state);
 }
 
 int sapp_cursor_delta_x(void) {
-    return _input_state.input_current.cursor.x - _input_state.input_prev.cursor.x;
+    return sapp_ctx_cursor_delta_x(&_input_state);
 }
 
 int sapp_cursor_delta_y(void) {
-    return _input_state.input_current.cursor.y - _input_state.input_prev.cursor.y;
+    return sapp_ctx_cursor_delta_y(&_input_state);
+}
+
+float sapp_cursor_xf(void) {
+    return sapp_ctx_cursor_xf(&_input_state);
+}
+
+float sapp_cursor_yf(void) {
+    return sapp_ctx_cursor_yf(&_input_state);
+}
+
+float sapp_cursor_delta_xf(void) {
+    return sapp_ctx_cursor_delta_xf(&_input_state);
+}
+
+float sapp_cursor_delta_yf(void) {
+    return sapp_ctx_cursor_delta_yf(&_input_state);
+}
+
+float sapp_mouse_raw_dx(void) {
+    return sapp_ctx_mouse_raw_dx(&_input_state);
+}
+
+float sapp_mouse_raw_dy(void) {
+    return sapp_ctx_mouse_raw_dy(&_input_state);
 }
 
 bool sapp_was_mouse_scrolled(void) {
-    return _input_state.input_current.scroll.x != 0 || _input_state.input_current.scroll.y != 0;
+    return sapp_ctx_was_mouse_scrolled(&_input_state);
 }
 
 float sapp_scroll_x(void) {
-    return _input_state.input_current.scroll.x;
+    return sapp_ctx_scroll_x(&_input_state);
 }
 
 float sapp_scroll_y(void) {
-    return _input_state.input_current.scroll.y;
+    return sapp_ctx_scroll_y(&_input_state);
+}
+
+int sapp_scroll_event_count(void) {
+    return sapp_ctx_scroll_event_count(&_input_state);
+}
+
+bool sapp_scroll_event(int index, float *x, float *y) {
+    return sapp_ctx_scroll_event(&_input_state, index, x, y);
+}
+
+sapp_input_iter sapp_input_records(void) {
+    return sapp_ctx_input_records(&_input_state);
+}
+
+const sapp_input_record* sapp_input_next_record(sapp_input_iter *iter) {
+    return sapp_ctx_input_next_record(&_input_state, iter);
+}
+
+int sapp_input_dropped_records(void) {
+    return sapp_ctx_input_dropped_records(&_input_state);
+}
+
+void sapp_input_set_threaded(bool enabled) {
+    sapp_ctx_input_set_threaded(&_input_state, enabled);
+}
+
+int sapp_input_pump(void) {
+    return sapp_ctx_input_pump(&_input_state);
+}
+
+int sapp_input_pump_dropped(void) {
+    return sapp_ctx_input_pump_dropped(&_input_state);
+}
+
+void sapp_input_snapshot(sapp_input_state *out) {
+    sapp_ctx_input_snapshot(&_input_state, out);
+}
+
+void sapp_input_start_recording(sapp_input_write_func write, void *user_data) {
+    sapp_ctx_input_start_recording(&_input_state, write, user_data);
+}
+
+void sapp_input_stop_recording(void) {
+    sapp_ctx_input_stop_recording(&_input_state);
+}
+
+bool sapp_input_replay_frame(sapp_input_replay *replay) {
+    return sapp_ctx_input_replay_frame(&_input_state, replay);
+}
+
+bool sapp_input_replay_file_frame(sapp_input_replay_file *file) {
+    return sapp_ctx_input_replay_file_frame(&_input_state, file);
+}
+
+bool sapp_input_seek_replay(sapp_input_replay_file *file, uint64_t frame) {
+    return sapp_ctx_input_seek_replay(&_input_state, file, frame);
+}
+
+int sapp_input_register_action(const char *name) {
+    return sapp_ctx_input_register_action(&_input_state, name);
+}
+
+int sapp_input_find_action(const char *name) {
+    return sapp_ctx_input_find_action(&_input_state, name);
+}
+
+bool sapp_input_bind_key(int action, int key, int modifiers) {
+    return sapp_ctx_input_bind_key(&_input_state, action, key, modifiers);
+}
+
+bool sapp_input_bind_button(int action, int button, int modifiers) {
+    return sapp_ctx_input_bind_button(&_input_state, action, button, modifiers);
+}
+
+void sapp_input_unbind_action(int action) {
+    sapp_ctx_input_unbind_action(&_input_state, action);
+}
+
+bool sapp_action_down(int action) {
+    return sapp_ctx_action_down(&_input_state, action);
+}
+
+bool sapp_action_pressed(int action) {
+    return sapp_ctx_action_pressed(&_input_state, action);
+}
+
+bool sapp_action_released(int action) {
+    return sapp_ctx_action_released(&_input_state, action);
+}
+
+int sapp_input_add_virtual_axis(const sapp_virtual_axis_desc *desc) {
+    return sapp_ctx_input_add_virtual_axis(&_input_state, desc);
+}
+
+void sapp_input_clear_virtual_axes(void) {
+    sapp_ctx_input_clear_virtual_axes(&_input_state);
+}
+
+float sapp_virtual_axis(int axis) {
+    return sapp_ctx_virtual_axis(&_input_state, axis);
+}
+
+const float *sapp_virtual_axes(int *count) {
+    return sapp_ctx_virtual_axes(&_input_state, count);
+}
+
+bool sapp_chord_all_down(const sapp_chord *chord) {
+    return sapp_ctx_chord_all_down(&_input_state, chord);
+}
+
+bool sapp_chord_any_down(const sapp_chord *chord) {
+    return sapp_ctx_chord_any_down(&_input_state, chord);
+}
+
+bool sapp_chord_pressed(const sapp_chord *chord) {
+    return sapp_ctx_chord_pressed(&_input_state, chord);
+}
+
+float sapp_key_hold_time(int key) {
+    return sapp_ctx_key_hold_time(&_input_state, key);
+}
+
+bool sapp_is_key_held(int key) {
+    return sapp_ctx_is_key_held(&_input_state, key);
+}
+
+bool sapp_was_key_hold_started(int key) {
+    return sapp_ctx_was_key_hold_started(&_input_state, key);
+}
+
+float sapp_button_hold_time(int button) {
+    return sapp_ctx_button_hold_time(&_input_state, button);
+}
+
+bool sapp_is_button_held(int button) {
+    return sapp_ctx_is_button_held(&_input_state, button);
+}
+
+bool sapp_was_button_hold_started(int button) {
+    return sapp_ctx_was_button_hold_started(&_input_state, button);
+}
+
+int sapp_input_register_combo(const int *steps, const float *timeouts, int count) {
+    return sapp_ctx_input_register_combo(&_input_state, steps, timeouts, count);
+}
+
+void sapp_input_clear_combos(void) {
+    sapp_ctx_input_clear_combos(&_input_state);
+}
+
+bool sapp_combo_triggered(int combo) {
+    return sapp_ctx_combo_triggered(&_input_state, combo);
+}
+
+bool sapp_input_set_history_keys(const int *keys, int n) {
+    return sapp_ctx_input_set_history_keys(&_input_state, keys, n);
+}
+
+bool sapp_input_history_frame(uint64_t frame, sapp_input_frame *out) {
+    return sapp_ctx_input_history_frame(&_input_state, frame, out);
+}
+
+void sapp_input_decode_frame(const sapp_input_frame *frame, const sapp_input_frame *prev, sapp_input_state *out) {
+    sapp_ctx_input_decode_frame(&_input_state, frame, prev, out);
+}
+
+size_t sapp_input_history_pack(uint64_t first, int count, void *buffer, size_t size) {
+    return sapp_ctx_input_history_pack(&_input_state, first, count, buffer, size);
+}
+
+int sapp_cursor_sample_count(void) {
+    return sapp_ctx_cursor_sample_count(&_input_state);
+}
+
+bool sapp_cursor_sample(int index, double *time, float *x, float *y) {
+    return sapp_ctx_cursor_sample(&_input_state, index, time, x, y);
+}
+
+void sapp_cursor_velocity(float *vx, float *vy) {
+    sapp_ctx_cursor_velocity(&_input_state, vx, vy);
+}
+
+void sapp_cursor_acceleration(float *ax, float *ay) {
+    sapp_ctx_cursor_acceleration(&_input_state, ax, ay);
+}
+
+void sapp_cursor_predict(float ms, int mode, float *x, float *y) {
+    sapp_ctx_cursor_predict(&_input_state, ms, mode, x, y);
+}
+
+int sapp_touches_down(void) {
+    return sapp_ctx_touches_down(&_input_state);
+}
+
+int sapp_touches_began(void) {
+    return sapp_ctx_touches_began(&_input_state);
+}
+
+int sapp_touches_moved(void) {
+    return sapp_ctx_touches_moved(&_input_state);
+}
+
+int sapp_touches_ended(void) {
+    return sapp_ctx_touches_ended(&_input_state);
+}
+
+int sapp_touches_cancelled(void) {
+    return sapp_ctx_touches_cancelled(&_input_state);
+}
+
+int sapp_touch_count(void) {
+    return sapp_ctx_touch_count(&_input_state);
+}
+
+int sapp_touch_find(uintptr_t identifier) {
+    return sapp_ctx_touch_find(&_input_state, identifier);
+}
+
+bool sapp_touch_position(int slot, float *x, float *y) {
+    return sapp_ctx_touch_position(&_input_state, slot, x, y);
+}
+
+bool sapp_touch_start(int slot, float *x, float *y, double *time) {
+    return sapp_ctx_touch_start(&_input_state, slot, x, y, time);
+}
+
+sapp_gesture_config sapp_input_gesture_config(void) {
+    return sapp_ctx_input_gesture_config(&_input_state);
+}
+
+void sapp_input_set_gesture_config(const sapp_gesture_config *config) {
+    sapp_ctx_input_set_gesture_config(&_input_state, config);
+}
+
+int sapp_gesture_count(void) {
+    return sapp_ctx_gesture_count(&_input_state);
+}
+
+bool sapp_gesture_event(int index, sapp_gesture *out) {
+    return sapp_ctx_gesture_event(&_input_state, index, out);
+}
+
+bool sapp_was_gesture(int type) {
+    return sapp_ctx_was_gesture(&_input_state, type);
+}
+
+void sapp_input_set_gamepad_backend(const sapp_gamepad_backend *backend) {
+    sapp_ctx_input_set_gamepad_backend(&_input_state, backend);
+}
+
+void sapp_input_poll_gamepads(void) {
+    sapp_ctx_input_poll_gamepads(&_input_state);
+}
+
+void sapp_input_gamepad_connect(int gamepad, bool connected) {
+    sapp_ctx_input_gamepad_connect(&_input_state, gamepad, connected);
+}
+
+void sapp_input_gamepad_button(int gamepad, int button, bool down) {
+    sapp_ctx_input_gamepad_button(&_input_state, gamepad, button, down);
+}
+
+void sapp_input_gamepad_axis(int gamepad, int axis, float value) {
+    sapp_ctx_input_gamepad_axis(&_input_state, gamepad, axis, value);
+}
+
+bool sapp_gamepad_connected(int gamepad) {
+    return sapp_ctx_gamepad_connected(&_input_state, gamepad);
+}
+
+bool sapp_is_gamepad_button_down(int gamepad, int button) {
+    return sapp_ctx_is_gamepad_button_down(&_input_state, gamepad, button);
+}
+
+bool sapp_was_gamepad_button_pressed(int gamepad, int button) {
+    return sapp_ctx_was_gamepad_button_pressed(&_input_state, gamepad, button);
+}
+
+bool sapp_was_gamepad_button_released(int gamepad, int button) {
+    return sapp_ctx_was_gamepad_button_released(&_input_state, gamepad, button);
+}
+
+uint32_t sapp_gamepad_buttons(int gamepad) {
+    return sapp_ctx_gamepad_buttons(&_input_state, gamepad);
+}
+
+float sapp_gamepad_axis(int gamepad, int axis) {
+    return sapp_ctx_gamepad_axis(&_input_state, gamepad, axis);
+}
+
+float sapp_gamepad_axis_raw(int gamepad, int axis) {
+    return sapp_ctx_gamepad_axis_raw(&_input_state, gamepad, axis);
+}
+
+sapp_gamepad_response sapp_input_gamepad_response(int group) {
+    return sapp_ctx_input_gamepad_response(&_input_state, group);
+}
+
+void sapp_input_set_gamepad_response(int group, const sapp_gamepad_response *response) {
+    sapp_ctx_input_set_gamepad_response(&_input_state, group, response);
+}
+
+#if defined(_INPUT_EVDEV)
+bool sapp_input_open_evdev(const char *directory) {
+    return sapp_ctx_input_open_evdev(&_input_state, directory);
+}
+
+int sapp_input_evdev_add_device(const char *path) {
+    return sapp_ctx_input_evdev_add_device(&_input_state, path);
+}
+#endif
+
+int sapp_input_add_gamepad_mappings(const char *mappings, size_t length) {
+    return sapp_ctx_input_add_gamepad_mappings(&_input_state, mappings, length);
+}
+
+void sapp_input_clear_gamepad_mappings(void) {
+    sapp_ctx_input_clear_gamepad_mappings(&_input_state);
+}
+
+bool sapp_input_has_gamepad_mapping(const char *guid) {
+    return sapp_ctx_input_has_gamepad_mapping(&_input_state, guid);
 }
 #endif // SOKOL_IMPL